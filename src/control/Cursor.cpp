@@ -1,4 +1,5 @@
 #include "Cursor.h"
+#include "../game/DrawList.h"
 
 //----------------------------------------------------------------------------
 // - Cursor Constructor
@@ -65,7 +66,7 @@ sf::FloatRect Cursor::getGlobalBounds() const
 void Cursor::poll()
 {
     // Keyboard Input handle : Down - move cursor downward
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+    if(pressed(sf::Keyboard::Down))
     {           
         // Move to the next valid position downward of this
         int y = position().y + 1;
@@ -81,7 +82,7 @@ void Cursor::poll()
     }
 
     // Keyboard Input handle : Up - move cursor upward
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+    if(pressed(sf::Keyboard::Up))
     {           
         // Move to the next valid position upward of this
         int y = position().y - 1;
@@ -97,7 +98,7 @@ void Cursor::poll()
     }
 
     // Keyboard Input handle : Left - move cursor left
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+    if(pressed(sf::Keyboard::Left))
     {
         // Move to the next valid position left of this
         int x = position().x - 1;
@@ -113,7 +114,7 @@ void Cursor::poll()
     }
 
     // Keyboard Input handle : Right - move cursor right
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+    if(pressed(sf::Keyboard::Right))
     {
         // Move to the next valid position right of this
         int x = position().x + 1;
@@ -129,13 +130,13 @@ void Cursor::poll()
     }
 
     // Keyboard Input handle : Enter|Space - select current position
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Return) || sf::Keyboard::isKeyPressed(sf::Keyboard::Space))
+    if(pressed(sf::Keyboard::Return) || pressed(sf::Keyboard::Space))
     {
         actionConfirm_(position());
     }
 
     // Keyboard Input handle : Esc - cancel selector
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Escape))
+    if(pressed(sf::Keyboard::Escape))
     {
         actionCancel_();
     }
@@ -185,6 +186,6 @@ void Cursor::setOnMove(std::function<void(const sf::Vector3f&)> action)
 void Cursor::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if(active()){
-        target.draw(sprite_, states);        
+        DrawList::submit(target, sprite_, states);        
     }
 }
\ No newline at end of file
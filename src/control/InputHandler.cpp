@@ -1,4 +1,6 @@
 #include "InputHandler.h"
+#include "../game/InputManager.h"
+#include "../game/RedrawTracker.h"
 
 //----------------------------------------------------------------------------
 // - InputHandler Constructor
@@ -48,5 +50,21 @@ bool InputHandler::active() const
 //----------------------------------------------------------------------------
 void InputHandler::setActive(bool active)
 {
+    if(active != active_)
+    {
+        // Menus are only shown while active
+        RedrawTracker::instance().request();
+    }
+
     active_ = active;
+}
+
+//----------------------------------------------------------------------------
+// - Key Pressed? (protected)
+//----------------------------------------------------------------------------
+// * key : key read from the input manager's current source
+//----------------------------------------------------------------------------
+bool InputHandler::pressed(sf::Keyboard::Key key) const
+{
+    return InputManager::instance().getSource().pressed(key);
 }
\ No newline at end of file
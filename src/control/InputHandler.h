@@ -1,11 +1,14 @@
 #ifndef TACTICS_INPUT_HANDLER_H
 #define TACTICS_INPUT_HANDLER_H
 
+#include <SFML/Window.hpp>
+
 //================================================================================
 // ** InputHandler
 //================================================================================
 // Abstract base for all objects able to handle input events such as keystrokes,
-// touchpad or mouse events
+// touchpad or mouse events. Keys are read from the input manager's current
+// source, never from the devices directly
 //================================================================================
 class InputHandler
 {
@@ -19,9 +22,11 @@ public:
     void            setActive(bool active);    
     virtual bool    busy() const;
     void            setBusy(bool busy);
+
+protected:
+    bool            pressed(sf::Keyboard::Key key) const;
     
 // Members
-protected:
     bool            busy_;
     bool            active_;
 };
@@ -0,0 +1,190 @@
+#include "InputPlayer.h"
+#include "../game/InputManager.h"
+#include <fstream>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+// - Input Player Constructor (Empty)
+//----------------------------------------------------------------------------
+InputPlayer::InputPlayer() :
+    next_(0),
+    diverged_(false),
+    start_(InputManager::instance().frame()),
+    seed_(0),
+    frames_(0),
+    hash_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Input Player Constructor
+//----------------------------------------------------------------------------
+// * polls : recorded polls to play back
+//----------------------------------------------------------------------------
+InputPlayer::InputPlayer(const std::vector<InputRecorder::Poll>& polls) :
+    polls_(polls),
+    next_(0),
+    diverged_(false),
+    start_(InputManager::instance().frame()),
+    seed_(0),
+    frames_(0),
+    hash_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Input Player Destructor
+//----------------------------------------------------------------------------
+InputPlayer::~InputPlayer()
+{}
+
+//----------------------------------------------------------------------------
+// - Key Pressed? (Override)
+//----------------------------------------------------------------------------
+// * key : key checked against those held down in the current recorded poll
+//----------------------------------------------------------------------------
+bool InputPlayer::pressed(sf::Keyboard::Key key) const
+{
+    return next_ < polls_.size() && key != sf::Keyboard::Unknown && polls_[next_].keys.test(key);
+}
+
+//----------------------------------------------------------------------------
+// - Advance Past Poll (Override)
+//----------------------------------------------------------------------------
+// Moves on to the next recorded poll, flagging the replay as diverged if this
+// poll did not happen on its recorded frame
+//----------------------------------------------------------------------------
+void InputPlayer::advance()
+{
+    if(next_ < polls_.size())
+    {
+        if(polls_[next_].frame != InputManager::instance().frame() - start_)
+        {
+            diverged_ = true;
+        }
+
+        next_++;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Load Recording
+//----------------------------------------------------------------------------
+// * filepath : text file saved by an input recorder
+// Replaces any polls held with those in the file, restarting playback. Fails
+// if the file cannot be read or lacks the recorder's header
+//----------------------------------------------------------------------------
+bool InputPlayer::load(const std::string& filepath)
+{
+    std::ifstream file(filepath.c_str());
+    std::string line;
+
+    if(!file || !std::getline(file, line))
+    {
+        return false;
+    }
+
+    // Header: seed <seed> frames <frames> hash <hex hash>
+    std::istringstream header(line);
+    std::string labels[3];
+    unsigned seed;
+    unsigned long frames;
+    uint64_t hash;
+
+    if(!(header >> labels[0] >> seed >> labels[1] >> frames >> labels[2] >> std::hex >> hash)
+        || labels[0] != "seed" || labels[1] != "frames" || labels[2] != "hash")
+    {
+        return false;
+    }
+
+    polls_.clear();
+    next_ = 0;
+    diverged_ = false;
+    seed_ = seed;
+    frames_ = frames;
+    hash_ = hash;
+
+    while(std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        InputRecorder::Poll poll;
+        int key;
+
+        if(!(fields >> poll.frame))
+        {
+            continue;
+        }
+
+        while(fields >> key)
+        {
+            if(key >= 0 && key < sf::Keyboard::KeyCount)
+            {
+                poll.keys.set(key);
+            }
+        }
+
+        polls_.push_back(poll);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// - Get Recorded Poll Count
+//----------------------------------------------------------------------------
+int InputPlayer::size() const
+{
+    return polls_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Get Played Poll Count
+//----------------------------------------------------------------------------
+int InputPlayer::played() const
+{
+    return next_;
+}
+
+//----------------------------------------------------------------------------
+// - Playback Finished?
+//----------------------------------------------------------------------------
+bool InputPlayer::finished() const
+{
+    return next_ >= polls_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Replay Diverged?
+//----------------------------------------------------------------------------
+// Returns whether any poll so far happened on a different frame than it was
+// recorded on, in which case the replay no longer matches the recording
+//----------------------------------------------------------------------------
+bool InputPlayer::diverged() const
+{
+    return diverged_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Recorded Seed
+//----------------------------------------------------------------------------
+unsigned InputPlayer::seed() const
+{
+    return seed_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Recorded Frame Count
+//----------------------------------------------------------------------------
+// Returns the number of fixed-timestep frames the recorded game ran for,
+// which may extend past its last poll
+//----------------------------------------------------------------------------
+unsigned long InputPlayer::frames() const
+{
+    return frames_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Recorded Final State Hash
+//----------------------------------------------------------------------------
+uint64_t InputPlayer::hash() const
+{
+    return hash_;
+}
\ No newline at end of file
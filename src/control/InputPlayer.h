@@ -0,0 +1,46 @@
+#ifndef TACTICS_INPUT_PLAYER_H
+#define TACTICS_INPUT_PLAYER_H
+
+#include "InputRecorder.h"
+
+//================================================================================
+// ** InputPlayer
+//================================================================================
+// Input source feeding recorded key states back, one recorded poll per poll.
+// Each poll is checked against the input manager frame it was recorded on,
+// counted from the player's creation, so a replay drifting from its recording
+// is flagged as diverged. Once the recording runs out, no key is pressed.
+// Recordings loaded from a file also carry the seed, length and final state
+// hash of the game they were recorded from
+//================================================================================
+class InputPlayer : public InputSource
+{
+// Methods
+public:
+    InputPlayer();
+    InputPlayer(const std::vector<InputRecorder::Poll>& polls);
+    virtual ~InputPlayer();
+
+    virtual bool                pressed(sf::Keyboard::Key key) const;
+    virtual void                advance();
+    bool                        load(const std::string& filepath);
+    int                         size() const;
+    int                         played() const;
+    bool                        finished() const;
+    bool                        diverged() const;
+    unsigned                    seed() const;
+    unsigned long               frames() const;
+    uint64_t                    hash() const;
+
+// Members
+protected:
+    std::vector<InputRecorder::Poll>    polls_;
+    int                         next_;
+    bool                        diverged_;
+    unsigned long               start_;
+    unsigned                    seed_;
+    unsigned long               frames_;
+    uint64_t                    hash_;
+};
+
+#endif
\ No newline at end of file
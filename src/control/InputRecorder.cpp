@@ -0,0 +1,100 @@
+#include "InputRecorder.h"
+#include "../game/InputManager.h"
+#include <fstream>
+
+//----------------------------------------------------------------------------
+// - Input Recorder Constructor
+//----------------------------------------------------------------------------
+// * source : source whose key states are passed through and logged
+//----------------------------------------------------------------------------
+InputRecorder::InputRecorder(InputSource& source) :
+    source_(&source),
+    start_(InputManager::instance().frame())
+{}
+
+//----------------------------------------------------------------------------
+// - Input Recorder Destructor
+//----------------------------------------------------------------------------
+InputRecorder::~InputRecorder()
+{}
+
+//----------------------------------------------------------------------------
+// - Key Pressed? (Override)
+//----------------------------------------------------------------------------
+// * key : key read from the recorded source, and logged if held down
+//----------------------------------------------------------------------------
+bool InputRecorder::pressed(sf::Keyboard::Key key) const
+{
+    bool down = source_->pressed(key);
+
+    if(down && key != sf::Keyboard::Unknown)
+    {
+        current_.set(key);
+    }
+
+    return down;
+}
+
+//----------------------------------------------------------------------------
+// - Advance Past Poll (Override)
+//----------------------------------------------------------------------------
+// Logs the keys held down during the poll just made
+//----------------------------------------------------------------------------
+void InputRecorder::advance()
+{
+    Poll poll;
+    poll.frame = InputManager::instance().frame() - start_;
+    poll.keys = current_;
+
+    polls_.push_back(poll);
+    current_.reset();
+    source_->advance();
+}
+
+//----------------------------------------------------------------------------
+// - Get Recorded Polls
+//----------------------------------------------------------------------------
+const std::vector<InputRecorder::Poll>& InputRecorder::polls() const
+{
+    return polls_;
+}
+
+//----------------------------------------------------------------------------
+// - Save Recording
+//----------------------------------------------------------------------------
+// * filepath : text file written with one poll per line: its frame, followed
+//      by the codes of the keys held down
+// * seed : seed the recorded game's random numbers were drawn from
+// * frames : number of fixed-timestep frames the recorded game ran for
+// * hash : hash of the recorded game's final state
+// A header line comes first, holding the seed, frame count and final state
+// hash, so that a replay can be run for as long and checked
+//----------------------------------------------------------------------------
+bool InputRecorder::save(const std::string& filepath, unsigned seed, unsigned long frames, uint64_t hash) const
+{
+    std::ofstream file(filepath.c_str());
+
+    if(!file)
+    {
+        return false;
+    }
+
+    file << "seed " << seed << " frames " << frames << " hash " << std::hex << hash << std::dec << '\n';
+
+    for(const Poll& poll : polls_)
+    {
+        file << poll.frame;
+
+        for(int key = 0; key < sf::Keyboard::KeyCount; key++)
+        {
+            if(poll.keys.test(key))
+            {
+                file << ' ' << key;
+            }
+        }
+
+        file << '\n';
+    }
+
+    return bool(file);
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef TACTICS_INPUT_RECORDER_H
+#define TACTICS_INPUT_RECORDER_H
+
+#include "InputSource.h"
+#include <bitset>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+//================================================================================
+// ** InputRecorder
+//================================================================================
+// Input source passing through another source while logging, for each poll,
+// the keys found held down and the input manager frame the poll happened on,
+// counted from the recorder's creation. Only keys a handler asked for are
+// logged, which is all a replay of the same polls needs. Input is only ever
+// read by polls, so a log of polls holds every key state the game saw
+//================================================================================
+class InputRecorder : public InputSource
+{
+// Methods
+public:
+    // Poll Record Sub-structure
+    struct Poll
+    {
+        unsigned long                       frame;
+        std::bitset<sf::Keyboard::KeyCount> keys;
+    };
+
+    InputRecorder(InputSource& source);
+    virtual ~InputRecorder();
+
+    virtual bool                pressed(sf::Keyboard::Key key) const;
+    virtual void                advance();
+    const std::vector<Poll>&    polls() const;
+    bool                        save(const std::string& filepath, unsigned seed, unsigned long frames, uint64_t hash) const;
+
+// Members
+protected:
+    InputSource*                source_;
+    std::vector<Poll>           polls_;
+    mutable std::bitset<sf::Keyboard::KeyCount> current_;
+    unsigned long               start_;
+};
+
+#endif
\ No newline at end of file
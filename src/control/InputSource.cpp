@@ -0,0 +1,22 @@
+#include "InputSource.h"
+
+//----------------------------------------------------------------------------
+// - Input Source Constructor
+//----------------------------------------------------------------------------
+InputSource::InputSource()
+{}
+
+//----------------------------------------------------------------------------
+// - Input Source Destructor
+//----------------------------------------------------------------------------
+InputSource::~InputSource()
+{}
+
+//----------------------------------------------------------------------------
+// - Advance Past Poll
+//----------------------------------------------------------------------------
+// Called once a handler has polled this source. Live sources have nothing to
+// advance
+//----------------------------------------------------------------------------
+void InputSource::advance()
+{}
\ No newline at end of file
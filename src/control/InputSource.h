@@ -0,0 +1,24 @@
+#ifndef TACTICS_INPUT_SOURCE_H
+#define TACTICS_INPUT_SOURCE_H
+
+#include <SFML/Window.hpp>
+
+//================================================================================
+// ** InputSource
+//================================================================================
+// Abstract source of key states read by input handlers when polled. Sources
+// are advanced once after every poll, so scripted sources may feed a new set of
+// keys to each poll
+//================================================================================
+class InputSource
+{
+// Methods
+public:
+    InputSource();
+    virtual ~InputSource();
+
+    virtual bool    pressed(sf::Keyboard::Key key) const = 0;
+    virtual void    advance();
+};
+
+#endif
\ No newline at end of file
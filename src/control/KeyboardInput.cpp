@@ -0,0 +1,23 @@
+#include "KeyboardInput.h"
+
+//----------------------------------------------------------------------------
+// - Keyboard Input Constructor
+//----------------------------------------------------------------------------
+KeyboardInput::KeyboardInput()
+{}
+
+//----------------------------------------------------------------------------
+// - Keyboard Input Destructor
+//----------------------------------------------------------------------------
+KeyboardInput::~KeyboardInput()
+{}
+
+//----------------------------------------------------------------------------
+// - Key Pressed? (Override)
+//----------------------------------------------------------------------------
+// * key : key whose current state is read from the keyboard
+//----------------------------------------------------------------------------
+bool KeyboardInput::pressed(sf::Keyboard::Key key) const
+{
+    return sf::Keyboard::isKeyPressed(key);
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef TACTICS_KEYBOARD_INPUT_H
+#define TACTICS_KEYBOARD_INPUT_H
+
+#include "InputSource.h"
+
+//================================================================================
+// ** KeyboardInput
+//================================================================================
+// Live input source reading the real-time state of the keyboard
+//================================================================================
+class KeyboardInput : public InputSource
+{
+// Methods
+public:
+    KeyboardInput();
+    virtual ~KeyboardInput();
+
+    virtual bool    pressed(sf::Keyboard::Key key) const;
+};
+
+#endif
\ No newline at end of file
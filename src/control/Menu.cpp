@@ -1,13 +1,14 @@
 #include "Menu.h"
+#include "../game/DrawList.h"
 #include "../settings.h"
 #include <math.h>
 
 //----------------------------------------------------------------------------
 // - Menu Constructor
 //----------------------------------------------------------------------------
-// * frameTexture : bitmap to use for the menu's frame (replace w/ Menu::Style)
+// * frameTexture : bitmap, or region of one, to use for the menu's frame (replace w/ Menu::Style)
 //----------------------------------------------------------------------------
-Menu::Menu(const sf::Texture& frameTexture) :
+Menu::Menu(const TextureRegion& frameTexture) :
     current_(0),
     frame_(frameTexture),
     width_(32),
@@ -15,7 +16,6 @@ Menu::Menu(const sf::Texture& frameTexture) :
     actionCancel_([](){})
 {
     body_.setFillColor(sf::Color::Blue);
-    font_.loadFromFile("resources/fonts/Arial.ttf");
     setOrigin(frame_.getGlobalBounds().left, frame_.getGlobalBounds().top);
 }
 
@@ -30,30 +30,34 @@ Menu::~Menu()
 //----------------------------------------------------------------------------
 // * label : text displayed as the option's label
 // * action : callback executed when the option is selected
+// The label in the option's place is reused, laying out only what changed
 //----------------------------------------------------------------------------
 void Menu::addOption(const std::string& label, std::function<void()> action)
 {
-    sf::Text labelSprite(label, font_, 16);
-    labelSprite.setPosition(4, 20 * options_.size() + 4);
-    labelSprite.setStyle(sf::Text::Bold);
+    int index = options_.size();
+
+    if(index == labels_.size())
+    {
+        labels_.push_back(TextLabel(16, true));
+        labels_.back().setPosition(4, 20 * index + 4);
+    }
+
+    labels_[index].setString(label);
+    labels_[index].setBold(index == 0);
 
     // Increase the width of the menu to hold a bolded label
-    unsigned int textWidth = ceil(labelSprite.getGlobalBounds().width);
+    unsigned int textWidth = ceil(GlyphAtlas::instance().measure(label, 16, true));
     if(textWidth > width_)
     {
         width_ = textWidth;
     }
-    
-    if(!options_.empty())
-    {
-        labelSprite.setStyle(sf::Text::Regular);
-    }
 
-    options_.push_back(std::pair<sf::Text, std::function<void()>>(labelSprite, action));
+    options_.push_back(action);
 
     // Update sprites to accommodate new option
     body_.setSize(sf::Vector2f(width_ + 8, options_.size() * 20 + 12));
     frame_.setSize(sf::Vector2u(width_ + 8, options_.size() * 20 + 12));
+    invalidate();
 }
 
 //----------------------------------------------------------------------------
@@ -63,6 +67,7 @@ void Menu::clear()
 {
     options_.clear();
     current_ = 0;
+    invalidate();
 }
 
 //----------------------------------------------------------------------------
@@ -71,13 +76,13 @@ void Menu::clear()
 void Menu::poll()
 {
     // Keyboard Input handle : Down - highlight next option
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+    if(pressed(sf::Keyboard::Down))
     {
         highlight((current_ + 1) % options_.size());            
     }
 
     // Keyboard Input handle : Up - highlight previous option
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+    if(pressed(sf::Keyboard::Up))
     {
         int previous = current_ - 1;
         if(previous < 0)
@@ -89,16 +94,16 @@ void Menu::poll()
     }
 
     // Keyboard Input handle : Enter|Space - select current option
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Return) || sf::Keyboard::isKeyPressed(sf::Keyboard::Space))
+    if(pressed(sf::Keyboard::Return) || pressed(sf::Keyboard::Space))
     {
         if(!options_.empty())
         {
-            options_[current_].second();
+            options_[current_]();
         }
     }
 
     // Keyboard Input handle : Esc - cancel menu
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Escape))
+    if(pressed(sf::Keyboard::Escape))
     {
         actionCancel_();
     }
@@ -141,10 +146,11 @@ void Menu::highlight(int optionIndex)
 {
     if((optionIndex < options_.size() && optionIndex >= 0) && optionIndex != current_)
     {
-        options_[current_].first.setStyle(sf::Text::Regular);
+        labels_[current_].setBold(false);
 
         current_ = optionIndex;
-        options_[current_].first.setStyle(sf::Text::Bold);
+        labels_[current_].setBold(true);
+        invalidate();
     }
 }
 
@@ -155,14 +161,28 @@ void Menu::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if(active() && !options_.empty())
     {
-        states.transform *= getTransform();
-        
-        target.draw(frame_, states);
-        target.draw(body_, states);
-        
-        for(int i = 0; i < options_.size(); i++)
-        {
-            target.draw(options_[i].first, states);
-        }
+        SpriteCached::draw(target, states);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Render Content (Override)
+//----------------------------------------------------------------------------
+void Menu::render(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.draw(frame_, states);
+    DrawList::submit(target, body_, states);
+
+    for(int i = 0; i < options_.size(); i++)
+    {
+        target.draw(labels_[i], states);
     }
 }
+
+//----------------------------------------------------------------------------
+// - Get Cached Area (Override)
+//----------------------------------------------------------------------------
+sf::FloatRect Menu::area() const
+{
+    return frame_.getGlobalBounds();
+}
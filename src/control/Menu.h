@@ -4,7 +4,8 @@
 #include "InputHandler.h"
 #include "../objects/AnimatedObject.h"
 #include "../sprite/SpriteMenuFrame.h"
-#include "../sprite/Sprite.h"
+#include "../sprite/SpriteCached.h"
+#include "../sprite/TextLabel.h"
 #include <functional>
 #include <string>
 #include <vector>
@@ -12,13 +13,15 @@
 //================================================================================
 // ** Menu
 //================================================================================
-// Simple menu with a set of actions that may selected using the keyboard or mouse
+// Simple menu with a set of actions that may selected using the keyboard or mouse.
+// Rendered again only when its options or highlight change. Option labels are
+// kept when cleared, to be reused by the options added in their place
 //================================================================================
-class Menu : public InputHandler, public Sprite
+class Menu : public InputHandler, public SpriteCached
 {
 // Methods
 public:
-    Menu(const sf::Texture& frameTexture);
+    Menu(const TextureRegion& frameTexture);
     virtual ~Menu();
 
     void                    addOption(const std::string& label, std::function<void()> action);
@@ -30,15 +33,17 @@ public:
 protected:
     void                    highlight(int optionIndex);
     virtual void            draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    virtual void            render(sf::RenderTarget& target, sf::RenderStates states) const;
+    virtual sf::FloatRect   area() const;
     
 // Members
     int                     current_;
     SpriteMenuFrame         frame_;
     sf::RectangleShape      body_;
     unsigned int            width_;
-    sf::Font                font_;
     std::function<void()>   actionCancel_;    
-    std::vector<std::pair<sf::Text, std::function<void()>>> options_;
+    std::vector<std::function<void()>> options_;
+    std::vector<TextLabel>  labels_;
 };
 
 #endif
\ No newline at end of file
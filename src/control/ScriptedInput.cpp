@@ -0,0 +1,112 @@
+#include "ScriptedInput.h"
+
+//----------------------------------------------------------------------------
+// - Scripted Input Constructor
+//----------------------------------------------------------------------------
+ScriptedInput::ScriptedInput() :
+    current_(sf::Keyboard::Unknown),
+    drawn_(false),
+    polls_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Scripted Input Destructor
+//----------------------------------------------------------------------------
+ScriptedInput::~ScriptedInput()
+{}
+
+//----------------------------------------------------------------------------
+// - Key Pressed? (Override)
+//----------------------------------------------------------------------------
+// * key : key checked against the press fed to the current poll
+//----------------------------------------------------------------------------
+bool ScriptedInput::pressed(sf::Keyboard::Key key) const
+{
+    draw();
+
+    return key != sf::Keyboard::Unknown && key == current_;
+}
+
+//----------------------------------------------------------------------------
+// - Advance Past Poll (Override)
+//----------------------------------------------------------------------------
+// Consumes the press fed to the poll just made. Every poll consumes exactly one
+// press, even if the handler read no keys, so the generator is called the same
+// number of times on every run
+//----------------------------------------------------------------------------
+void ScriptedInput::advance()
+{
+    draw();
+
+    if(!queue_.empty())
+    {
+        queue_.pop_front();
+    }
+
+    current_ = sf::Keyboard::Unknown;
+    drawn_ = false;
+    polls_++;
+}
+
+//----------------------------------------------------------------------------
+// - Draw Press (protected)
+//----------------------------------------------------------------------------
+// Picks the press fed to the current poll, from the front of the queue or else
+// the generator, at most once per poll
+//----------------------------------------------------------------------------
+void ScriptedInput::draw() const
+{
+    if(!drawn_)
+    {
+        if(!queue_.empty())
+        {
+            current_ = queue_.front();
+        }
+        else if(generator_)
+        {
+            current_ = generator_();
+        }
+
+        drawn_ = true;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Queue Key Press
+//----------------------------------------------------------------------------
+// * key : key held down for a single poll; sf::Keyboard::Unknown presses
+//      nothing for that poll
+//----------------------------------------------------------------------------
+void ScriptedInput::press(sf::Keyboard::Key key)
+{
+    queue_.push_back(key);
+}
+
+//----------------------------------------------------------------------------
+// - Set Press Generator
+//----------------------------------------------------------------------------
+// * generator : callable returning the key to press whenever the queue is
+//      empty
+//----------------------------------------------------------------------------
+void ScriptedInput::setGenerator(std::function<sf::Keyboard::Key()> generator)
+{
+    generator_ = generator;
+}
+
+//----------------------------------------------------------------------------
+// - Queue Empty?
+//----------------------------------------------------------------------------
+bool ScriptedInput::empty() const
+{
+    return queue_.empty();
+}
+
+//----------------------------------------------------------------------------
+// - Get Poll Count
+//----------------------------------------------------------------------------
+// Returns the number of polls fed by this source so far
+//----------------------------------------------------------------------------
+unsigned long ScriptedInput::polls() const
+{
+    return polls_;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef TACTICS_SCRIPTED_INPUT_H
+#define TACTICS_SCRIPTED_INPUT_H
+
+#include "InputSource.h"
+#include <deque>
+#include <functional>
+
+//================================================================================
+// ** ScriptedInput
+//================================================================================
+// Input source replaying a queue of key presses, one per poll, independent of
+// the keyboard and of wall-clock time. Once the queue runs dry, presses are
+// drawn from an optional generator (an AI, or a seeded random player), and
+// otherwise no key is pressed
+//================================================================================
+class ScriptedInput : public InputSource
+{
+// Methods
+public:
+    ScriptedInput();
+    virtual ~ScriptedInput();
+
+    virtual bool    pressed(sf::Keyboard::Key key) const;
+    virtual void    advance();
+    void            press(sf::Keyboard::Key key);
+    void            setGenerator(std::function<sf::Keyboard::Key()> generator);
+    bool            empty() const;
+    unsigned long   polls() const;
+
+protected:
+    void            draw() const;
+
+// Members
+    std::deque<sf::Keyboard::Key>       queue_;
+    std::function<sf::Keyboard::Key()>  generator_;
+    mutable sf::Keyboard::Key           current_;
+    mutable bool                        drawn_;
+    unsigned long                       polls_;
+};
+
+#endif
\ No newline at end of file
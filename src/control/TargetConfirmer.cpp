@@ -1,5 +1,6 @@
 #include "TargetConfirmer.h"
 #include "../game/ActionScheduler.h"
+#include "../game/DrawList.h"
 
 //----------------------------------------------------------------------------
 // - Target Confirmer Constructor
@@ -62,7 +63,7 @@ void TargetConfirmer::poll()
     // Cannot cycle through an empty target list
     if(!targets_.empty()){
         // Keyboard Input handle : Down - move cursor to previous target
-        if(sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+        if(pressed(sf::Keyboard::Down))
         {
             Actor* next = targets_[(current_ - 1) % targets_.size()];
             moveTo(next->position());
@@ -70,7 +71,7 @@ void TargetConfirmer::poll()
         }
 
         // Keyboard Input handle : Up - move cursor to next target
-        if(sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+        if(pressed(sf::Keyboard::Up))
         {           
             Actor* next = targets_[(current_ + 1) % targets_.size()];
             moveTo(next->position());
@@ -78,7 +79,7 @@ void TargetConfirmer::poll()
         }
 
         // Keyboard Input handle : Left - move cursor to previous target
-        if(sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+        if(pressed(sf::Keyboard::Left))
         {
             Actor* next = targets_[(current_ - 1) % targets_.size()];
             moveTo(next->position());
@@ -86,7 +87,7 @@ void TargetConfirmer::poll()
         }
 
         // Keyboard Input handle : Right - move cursor  to next target
-        if(sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+        if(pressed(sf::Keyboard::Right))
         {
             Actor* next = targets_[(current_ + 1) % targets_.size()];
             moveTo(next->position());
@@ -95,13 +96,13 @@ void TargetConfirmer::poll()
     }
 
     // Keyboard Input handle : Enter|Space - confirm cast
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Return) || sf::Keyboard::isKeyPressed(sf::Keyboard::Space))
+    if(pressed(sf::Keyboard::Return) || pressed(sf::Keyboard::Space))
     {
         actionConfirm_();
     }
 
     // Keyboard Input handle : Esc - cancel menu
-    if(sf::Keyboard::isKeyPressed(sf::Keyboard::Escape))
+    if(pressed(sf::Keyboard::Escape))
     {
         actionCancel_();
     }
@@ -141,7 +142,7 @@ void TargetConfirmer::setOnCancel(std::function<void()> action)
 void TargetConfirmer::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if(active()){
-        target.draw(sprite_, states);        
+        DrawList::submit(target, sprite_, states);        
     }
 }
 
@@ -2,17 +2,25 @@
 #include <algorithm>
 
 //----------------------------------------------------------------------------
-// - Action Scheduler Constructor
+// - Action Constructor (Empty)
 //----------------------------------------------------------------------------
-// * action : callable to execute upon activation
-// * delay : number of frames before the action executes
-// * sender : object which initiated this action
+// Creates an action with nothing to execute and no delay or trigger
 //----------------------------------------------------------------------------
-Action::Action(std::function<void()> action, int delay, void* sender) :
-    action_(action),
-    delay_(delay),
-    sender_(sender),
-    trigger_([](){return false;})
+Action::Action() :
+    delay_(-1),
+    sender_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Action Move Constructor
+//----------------------------------------------------------------------------
+// * other : action whose callables are moved here
+//----------------------------------------------------------------------------
+Action::Action(Action&& other) :
+    action_(std::move(other.action_)),
+    delay_(other.delay_),
+    sender_(other.sender_),
+    trigger_(std::move(other.trigger_))
 {}
 
 //----------------------------------------------------------------------------
@@ -21,12 +29,30 @@ Action::Action(std::function<void()> action, int delay, void* sender) :
 Action::~Action()
 {}
 
+//----------------------------------------------------------------------------
+// - Move Assignment
+//----------------------------------------------------------------------------
+// * other : action whose callables are moved here
+//----------------------------------------------------------------------------
+Action& Action::operator=(Action&& other)
+{
+    action_ = std::move(other.action_);
+    delay_ = other.delay_;
+    sender_ = other.sender_;
+    trigger_ = std::move(other.trigger_);
+
+    return *this;
+}
+
 //----------------------------------------------------------------------------
 // - Execute Action
 //----------------------------------------------------------------------------
 void Action::execute()
 {
-    action_();
+    if(action_)
+    {
+        action_();
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -37,6 +63,14 @@ int Action::countdown()
     return delay_--;
 }
 
+//----------------------------------------------------------------------------
+// - Get Remaining Delay
+//----------------------------------------------------------------------------
+int Action::delay() const
+{
+    return delay_;
+}
+
 //----------------------------------------------------------------------------
 // - Get Sender
 //----------------------------------------------------------------------------
@@ -46,20 +80,19 @@ void* Action::sender() const
 }
 
 //----------------------------------------------------------------------------
-// - Is Event Triggered?
+// - Has Trigger?
 //----------------------------------------------------------------------------
-bool Action::triggered() const
+// Returns whether a trigger condition was set, and must be polled
+//----------------------------------------------------------------------------
+bool Action::hasTrigger() const
 {
-    return trigger_();
+    return bool(trigger_);
 }
 
 //----------------------------------------------------------------------------
-// - Set Trigger
-//----------------------------------------------------------------------------
-// * trigger : predicate callable which designates what condition causes this
-//      action to execute alongside the duration, whichever comes first
+// - Is Event Triggered?
 //----------------------------------------------------------------------------
-void Action::setTrigger(std::function<bool()> trigger)
+bool Action::triggered() const
 {
-    trigger_ = trigger;
-}
+    return trigger_ && trigger_();
+}
\ No newline at end of file
@@ -1,32 +1,48 @@
 #ifndef TACTICS_ACTION_H
 #define TACTICS_ACTION_H
 
-#include <functional>
+#include "InlineFunction.h"
+
+// Bytes available to an action's callables for their captures
+static const int ACTION_CAPACITY = 48;
 
 //================================================================================
 // ** Action
 //================================================================================
 // Represents an action that may be scheduled to occur in a number of frames or by
-// a specific Boolean trigger condition
+// a specific Boolean trigger condition. Actions are move-only, their callables
+// stored inline so that creating and scheduling them never allocates
 //================================================================================
 class Action
 {
 // Methods
 public:
-    Action(std::function<void()> action, int delay, void* sender = 0);
+    typedef InlineFunction<void(), ACTION_CAPACITY> Callback;
+    typedef InlineFunction<bool(), ACTION_CAPACITY> Trigger;
+
+    Action();
+    template <typename Callable>
+    Action(Callable&& action, int delay, void* sender = 0);
+    Action(Action&& other);
     virtual ~Action();
 
+    Action& operator=(Action&& other);
     void    execute();
     int     countdown();
+    int     delay() const;
     void*   sender() const;
+    bool    hasTrigger() const;
     bool    triggered() const;
-    void    setTrigger(std::function<bool()> trigger);
+    template <typename Callable>
+    void    setTrigger(Callable&& trigger);
 
 protected:
-    std::function<void()>   action_;
+    Callback                action_;
     int                     delay_;
     void*                   sender_;
-    std::function<bool()>   trigger_;
+    Trigger                 trigger_;
 };
 
+#include "Action.inl"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,26 @@
+//----------------------------------------------------------------------------
+// - Action Constructor
+//----------------------------------------------------------------------------
+// * action : callable to execute upon activation
+// * delay : number of frames before the action executes. A negative delay
+//      leaves the action to its trigger alone
+// * sender : object which initiated this action
+//----------------------------------------------------------------------------
+template <typename Callable>
+Action::Action(Callable&& action, int delay, void* sender) :
+    action_(std::forward<Callable>(action)),
+    delay_(delay),
+    sender_(sender)
+{}
+
+//----------------------------------------------------------------------------
+// - Set Trigger
+//----------------------------------------------------------------------------
+// * trigger : predicate callable which designates what condition causes this
+//      action to execute alongside the duration, whichever comes first
+//----------------------------------------------------------------------------
+template <typename Callable>
+void Action::setTrigger(Callable&& trigger)
+{
+    trigger_ = Trigger(std::forward<Callable>(trigger));
+}
\ No newline at end of file
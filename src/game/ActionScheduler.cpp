@@ -1,10 +1,20 @@
 #include "ActionScheduler.h"
+#include <algorithm>
+
+// Timer wheel dimensions: each level has 2^WHEEL_BITS slots
+static const int WHEEL_BITS = 6;
+static const int WHEEL_SLOTS = 1 << WHEEL_BITS;
+static const int WHEEL_LEVELS = 4;
 
 //----------------------------------------------------------------------------
 // - Action Scheduler Constructor (private)
 //----------------------------------------------------------------------------
 ActionScheduler::ActionScheduler() :
-    AnimatedObject(FPS)
+    AnimatedObject(FPS),
+    wheel_(WHEEL_LEVELS * WHEEL_SLOTS),
+    frame_(0),
+    sequence_(0),
+    size_(0)
 {}
 
 //----------------------------------------------------------------------------
@@ -22,24 +32,80 @@ ActionScheduler::~ActionScheduler()
 //----------------------------------------------------------------------------
 // - Increment Frame
 //----------------------------------------------------------------------------
-// Decrements each scheduled action's remaining frame delay. If any action
-// reaches zero remaining frames or the action has a special trigger which is
-// activated, it is executed and then removed from the schedule
+// Advances the wheel by one frame, cascading coarser slots down as they come
+// due. Actions in the current frame's slot, and polled actions whose trigger
+// is activated, are removed from the schedule and executed in the order they
+// were scheduled
 //----------------------------------------------------------------------------
 void ActionScheduler::step()
 {
-    for(auto action = schedule_.begin(); action != schedule_.end();)
+    frame_++;
+
+    // Coarsest levels first, so their actions can cascade all the way down
+    for(int level = WHEEL_LEVELS - 1; level > 0; level--)
     {
-        if(action->countdown() == 0 || action->triggered())
+        if((frame_ & ((1UL << (WHEEL_BITS * level)) - 1)) == 0)
         {
-            action->execute();
-            action = schedule_.erase(action);
+            cascade(level);
         }
-        else
+    }
+
+    std::vector<Handle>& slot = wheel_[frame_ & (WHEEL_SLOTS - 1)];
+    for(const Handle& handle : slot)
+    {
+        if(live(handle))
         {
-            action++;
+            fired_.push_back(handle);
         }
     }
+    slot.clear();
+
+    for(int i = 0; i < polled_.size();)
+    {
+        if(live(polled_[i]))
+        {
+            const Entry& entry = entries_[polled_[i].index];
+
+            // Actions due this frame were already collected from the wheel
+            bool due = entry.timed && entry.due == frame_;
+
+            if(!due && !entry.action.triggered())
+            {
+                i++;
+                continue;
+            }
+            else if(!due)
+            {
+                fired_.push_back(polled_[i]);
+            }
+        }
+
+        polled_[i] = polled_.back();
+        polled_.pop_back();
+    }
+
+    std::sort(fired_.begin(), fired_.end(), [this](const Handle& a, const Handle& b){
+        return entries_[a.index].sequence < entries_[b.index].sequence;
+    });
+
+    for(const Handle& handle : fired_)
+    {
+        // Earlier actions may have cancelled later ones
+        if(live(handle))
+        {
+            // Moved out, since executing may schedule and grow the slab
+            Action action(std::move(entries_[handle.index].action));
+            release(handle.index);
+            action.execute();
+        }
+    }
+    fired_.clear();
+
+    // Idle until an action is scheduled
+    if(size_ == 0)
+    {
+        sleep();
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -58,15 +124,83 @@ ActionScheduler& ActionScheduler::instance()
 //----------------------------------------------------------------------------
 bool ActionScheduler::empty() const
 {
-    return schedule_.empty();
+    return size_ == 0;
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Scheduled Actions
+//----------------------------------------------------------------------------
+int ActionScheduler::size() const
+{
+    return size_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Current Frame
+//----------------------------------------------------------------------------
+// Returns the number of frames the scheduler has stepped through
+//----------------------------------------------------------------------------
+unsigned long ActionScheduler::frame() const
+{
+    return frame_;
 }
 
 //----------------------------------------------------------------------------
 // - Schedule Action
 //----------------------------------------------------------------------------
-void ActionScheduler::schedule(const Action& action)
+// * action : action to execute once its delay has passed, or its trigger is
+//      activated. A delay of 0 executes on the next step
+//----------------------------------------------------------------------------
+void ActionScheduler::schedule(Action&& action)
+{
+    bool timed = action.delay() >= 0;
+    bool triggered = action.hasTrigger();
+    Handle handle = add(std::move(action));
+
+    if(timed)
+    {
+        arm(handle);
+    }
+    else if(triggered)
+    {
+        polled_.push_back(handle);
+    }
+
+    wake();
+}
+
+//----------------------------------------------------------------------------
+// - Schedule Action on Signal
+//----------------------------------------------------------------------------
+// * action : action to execute once its delay has passed after the signal is
+//      emitted, or its trigger is activated after that. Negative delays count
+//      as 0
+// * signal : signal starting the action's delay when emitted
+// The action is not visited at all, nor its trigger polled, until the signal
+// is emitted, and may be cancelled by sender in the meantime
+//----------------------------------------------------------------------------
+void ActionScheduler::schedule(Action&& action, Signal& signal)
+{
+    Handle handle = add(std::move(action));
+    signal.connect([this, handle](){arm(handle);});
+
+    wake();
+}
+
+//----------------------------------------------------------------------------
+// - Cancel Actions by Sender
+//----------------------------------------------------------------------------
+// * sender : object whose scheduled actions are all removed unexecuted
+//----------------------------------------------------------------------------
+void ActionScheduler::cancel(void* sender)
 {
-    schedule_.push_back(action);
+    for(int i = 0; i < entries_.size(); i++)
+    {
+        if(entries_[i].live && entries_[i].action.sender() == sender)
+        {
+            release(i);
+        }
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -76,5 +210,160 @@ void ActionScheduler::schedule(const Action& action)
 //----------------------------------------------------------------------------
 void ActionScheduler::clear()
 {
-    schedule_.clear();
+    for(int i = 0; i < entries_.size(); i++)
+    {
+        if(entries_[i].live)
+        {
+            release(i);
+        }
+    }
+
+    for(std::vector<Handle>& slot : wheel_)
+    {
+        slot.clear();
+    }
+
+    overflow_.clear();
+    polled_.clear();
+}
+
+//----------------------------------------------------------------------------
+// - Is Handle Live? (private)
+//----------------------------------------------------------------------------
+// * handle : handle to check against the slab
+// Returns whether the handle still refers to the action it was made for
+//----------------------------------------------------------------------------
+bool ActionScheduler::live(const Handle& handle) const
+{
+    return handle.index < entries_.size() && entries_[handle.index].live && entries_[handle.index].generation == handle.generation;
+}
+
+//----------------------------------------------------------------------------
+// - Add Action to Slab (private)
+//----------------------------------------------------------------------------
+// * action : action to hold until executed or cancelled
+// Returns a handle to the new entry, neither polled nor in the wheel yet
+//----------------------------------------------------------------------------
+ActionScheduler::Handle ActionScheduler::add(Action&& action)
+{
+    int index;
+
+    if(free_.empty())
+    {
+        index = entries_.size();
+        entries_.push_back(Entry{std::move(action), 0, 0, 0, false, false});
+    }
+    else
+    {
+        index = free_.back();
+        free_.pop_back();
+        entries_[index].action = std::move(action);
+    }
+
+    Entry& entry = entries_[index];
+    entry.timed = false;
+    entry.sequence = sequence_++;
+    entry.live = true;
+    size_++;
+
+    return Handle{index, entry.generation};
+}
+
+//----------------------------------------------------------------------------
+// - Insert Handle into Wheel (private)
+//----------------------------------------------------------------------------
+// * handle : handle of a timed action due at or after the current frame
+// Places the handle on the finest level whose span covers its remaining
+// delay, in the slot of its due frame at that level's resolution
+//----------------------------------------------------------------------------
+void ActionScheduler::insert(const Handle& handle)
+{
+    unsigned long due = entries_[handle.index].due;
+    unsigned long delta = due - frame_;
+
+    for(int level = 0; level < WHEEL_LEVELS; level++)
+    {
+        if(delta < (1UL << (WHEEL_BITS * (level + 1))))
+        {
+            int slot = (due >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+            wheel_[level * WHEEL_SLOTS + slot].push_back(handle);
+            return;
+        }
+    }
+
+    // Beyond the wheel's span, re-inserted each time the last level cascades
+    overflow_.push_back(handle);
+}
+
+//----------------------------------------------------------------------------
+// - Arm Action (private)
+//----------------------------------------------------------------------------
+// * handle : handle of the action whose delay starts counting now
+// Inserts the action into the wheel, and polls its trigger from now on
+//----------------------------------------------------------------------------
+void ActionScheduler::arm(const Handle& handle)
+{
+    if(!live(handle))
+    {
+        return;
+    }
+
+    Entry& entry = entries_[handle.index];
+    entry.timed = true;
+    entry.due = frame_ + std::max(0, entry.action.delay()) + 1;
+    insert(handle);
+
+    if(entry.action.hasTrigger())
+    {
+        polled_.push_back(handle);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Cascade Wheel Level (private)
+//----------------------------------------------------------------------------
+// * level : level whose slot for the current frame is re-inserted into finer
+//      levels
+//----------------------------------------------------------------------------
+void ActionScheduler::cascade(int level)
+{
+    int slot = (frame_ >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+
+    // Copied to a scratch list, so both keep their capacity
+    std::vector<Handle>& handles = wheel_[level * WHEEL_SLOTS + slot];
+    cascading_.assign(handles.begin(), handles.end());
+    handles.clear();
+
+    if(level == WHEEL_LEVELS - 1)
+    {
+        cascading_.insert(cascading_.end(), overflow_.begin(), overflow_.end());
+        overflow_.clear();
+    }
+
+    for(const Handle& handle : cascading_)
+    {
+        if(live(handle))
+        {
+            insert(handle);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Release Slab Entry (private)
+//----------------------------------------------------------------------------
+// * index : slab index of the action to remove from the schedule
+// Invalidates all handles to the entry and frees its captures
+//----------------------------------------------------------------------------
+void ActionScheduler::release(int index)
+{
+    // Moved out and destroyed last, since its captures may schedule actions
+    // when destroyed and grow the slab
+    Action action(std::move(entries_[index].action));
+    Entry& entry = entries_[index];
+
+    entry.live = false;
+    entry.generation++;
+    free_.push_back(index);
+    size_--;
 }
\ No newline at end of file
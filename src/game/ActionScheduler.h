@@ -2,14 +2,24 @@
 #define TACTICS_ACTION_SCHEDULER_H
 
 #include "Action.h"
+#include "Signal.h"
 #include "../objects/AnimatedObject.h"
 #include "../settings.h"
-#include <deque>
+#include <vector>
 
 //================================================================================
 // ** ActionScheduler
 //================================================================================
-// Singleton scheduler for executing scheduled actions in relative game time
+// Singleton scheduler for executing scheduled actions in relative game time.
+// Timed actions are kept in a hierarchical timer wheel keyed on absolute frame
+// numbers: 4 levels of 64 slots, each level 64 times coarser than the last,
+// with slots of coarser levels cascading down as their time comes. Only the
+// slot of the current frame is visited each step, and only actions with a
+// trigger condition are polled. Actions live in a slab and are referred to by
+// generation-checked handles, so cancelled actions are simply skipped.
+// Actions may also wait on a signal, entering the wheel and being polled only
+// once it is emitted. Actions are moved into the slab, and all containers keep
+// their capacity, so steady-state scheduling does not allocate
 //================================================================================
 class ActionScheduler : public AnimatedObject
 {
@@ -23,12 +33,50 @@ private:
 public:
     static ActionScheduler& instance();
     bool                    empty() const;
-    void                    schedule(const Action& action);
+    int                     size() const;
+    unsigned long           frame() const;
+    void                    schedule(Action&& action);
+    void                    schedule(Action&& action, Signal& signal);
+    void                    cancel(void* sender);
     void                    clear();
 
-// Members
 private:
-    std::deque<Action>     schedule_;
+    // Slab Entry Sub-structure
+    struct Entry
+    {
+        Action                  action;
+        unsigned long           due;
+        unsigned                sequence;
+        unsigned                generation;
+        bool                    timed;
+        bool                    live;
+    };
+
+    // Entry Handle Sub-structure
+    struct Handle
+    {
+        int                     index;
+        unsigned                generation;
+    };
+
+    bool                    live(const Handle& handle) const;
+    Handle                  add(Action&& action);
+    void                    insert(const Handle& handle);
+    void                    arm(const Handle& handle);
+    void                    cascade(int level);
+    void                    release(int index);
+
+// Members
+    std::vector<Entry>      entries_;
+    std::vector<int>        free_;
+    std::vector<std::vector<Handle>> wheel_;
+    std::vector<Handle>     overflow_;
+    std::vector<Handle>     polled_;
+    std::vector<Handle>     fired_;
+    std::vector<Handle>     cascading_;
+    unsigned long           frame_;
+    unsigned                sequence_;
+    int                     size_;
 };
 
 #endif
\ No newline at end of file
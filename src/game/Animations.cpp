@@ -1,12 +1,30 @@
 #include "Animations.h"
 #include "../objects/AnimatedObject.h"
+#include "ThreadPool.h"
+#include "Signal.h"
+#include "../settings.h"
+#include <utility>
+#include <algorithm>
+
+// Objects stepped by one work item of a parallel phase
+static const int PARALLEL_CHUNK = 256;
+
+// Slot of the object being stepped by this thread in a concurrent phase
+static thread_local int stepping = -1;
 
 //----------------------------------------------------------------------------
 // - Animations Manager Constructor (private)
 //----------------------------------------------------------------------------
 Animations::Animations() :
-    front_(0),
-    frozen_(false)
+    frozen_(false),
+    updating_(false),
+    parallel_(true),
+    concurrent_(false),
+    sleepers_(false),
+    maxElapsed_(MAX_ELAPSED),
+    maxSteps_(MAX_STEPS_PER_FRAME),
+    droppedTime_(0),
+    droppedSteps_(0)
 {}
 
 //----------------------------------------------------------------------------
@@ -18,15 +36,19 @@ Animations::Animations(const Animations& copy)
 //----------------------------------------------------------------------------
 // - Animations Manager Destructor
 //----------------------------------------------------------------------------
+// Releases the handles of any objects outliving the manager
+//----------------------------------------------------------------------------
 Animations::~Animations()
 {
-    Node* next, *current(front_);
-
-    while(current)
+    for(Bucket& bucket : buckets_)
     {
-        next = current->next();
-        delete current;
-        current = next;
+        for(AnimatedObject* obj : bucket.objects)
+        {
+            if(obj)
+            {
+                obj->animIndex_ = -1;
+            }
+        }
     }
 }
 
@@ -43,20 +65,175 @@ Animations& Animations::instance()
 // - Register Object to Manager
 //----------------------------------------------------------------------------
 // * obj : Animated object this manager will now handle
-// Pushes a new animated object to the front of the list composed into a node
+// Appends the object to the bucket matching its frame rate, creating one if
+// needed, and stores its index as its handle. New objects start awake. Objects
+// added during an update are first stepped on the next one
 //----------------------------------------------------------------------------
 void Animations::add(AnimatedObject* obj)
 {
-    if(obj)
+    if(!obj || obj->animIndex_ >= 0)
     {
-        Node* addition = new Node(obj, this, 0, front_);
-        if(front_)
-        {
-            front_->setPrevious(addition);
-        }
-        
-        front_ = addition;
+        return;
+    }
+
+    int b = 0;
+    while(b < buckets_.size() && buckets_[b].fps != obj->fps_)
+    {
+        b++;
+    }
+
+    if(b == buckets_.size())
+    {
+        buckets_.push_back(Bucket{obj->fps_, 0, std::vector<AnimatedObject*>(), 0, false, false});
+    }
+
+    Bucket& bucket = buckets_[b];
+
+    obj->animBucket_ = b;
+    obj->animIndex_ = bucket.objects.size();
+    obj->sleepy_ = false;
+    bucket.objects.push_back(obj);
+
+    // Move past the sleeping objects, to the end of the awake ones
+    swap(bucket, obj->animIndex_, bucket.awake++);
+}
+
+//----------------------------------------------------------------------------
+// - De-register Object from Manager
+//----------------------------------------------------------------------------
+// * obj : Animated object this manager will no longer handle
+// Removes the object's slot in constant time. During an update, the slot is
+// only cleared, and the bucket compacted once the update is done
+//----------------------------------------------------------------------------
+void Animations::remove(AnimatedObject* obj)
+{
+    if(!obj || obj->animIndex_ < 0)
+    {
+        return;
+    }
+
+    Bucket& bucket = buckets_[obj->animBucket_];
+    int index = obj->animIndex_;
+
+    if(updating_)
+    {
+        bucket.objects[index] = 0;
+        bucket.stale = true;
+    }
+    else
+    {
+        removeAt(bucket, index);
+    }
+
+    obj->animIndex_ = -1;
+}
+
+//----------------------------------------------------------------------------
+// - Put Object to Sleep
+//----------------------------------------------------------------------------
+// * obj : Animated object which will no longer be stepped until woken
+// Moves the object behind the awake objects of its bucket. During an update,
+// the object is only flagged and moved once the update is done
+//----------------------------------------------------------------------------
+void Animations::sleep(AnimatedObject* obj)
+{
+    if(!obj || obj->animIndex_ < 0)
+    {
+        return;
+    }
+
+    Bucket& bucket = buckets_[obj->animBucket_];
+
+    if(obj->animIndex_ >= bucket.awake)
+    {
+        return;
+    }
+
+    if(concurrent_)
+    {
+        // Buckets are shared across threads, and only flagged after the phase
+        obj->sleepy_ = true;
+        sleepers_.store(true, std::memory_order_relaxed);
+    }
+    else if(updating_)
+    {
+        obj->sleepy_ = true;
+        bucket.drowsy = true;
+    }
+    else
+    {
+        swap(bucket, obj->animIndex_, --bucket.awake);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Wake Object
+//----------------------------------------------------------------------------
+// * obj : Animated object which will be stepped again from the next update
+//----------------------------------------------------------------------------
+void Animations::wake(AnimatedObject* obj)
+{
+    if(!obj || obj->animIndex_ < 0)
+    {
+        return;
+    }
+
+    Bucket& bucket = buckets_[obj->animBucket_];
+    obj->sleepy_ = false;
+
+    if(obj->animIndex_ >= bucket.awake)
+    {
+        swap(bucket, obj->animIndex_, bucket.awake++);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Is Object Awake?
+//----------------------------------------------------------------------------
+// * obj : Animated object to check
+// Returns whether the object is registered and will be stepped on updates
+//----------------------------------------------------------------------------
+bool Animations::awake(const AnimatedObject* obj) const
+{
+    return obj && obj->animIndex_ >= 0 && !obj->sleepy_ && obj->animIndex_ < buckets_[obj->animBucket_].awake;
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Registered Objects
+//----------------------------------------------------------------------------
+int Animations::size() const
+{
+    int size = 0;
+
+    for(const Bucket& bucket : buckets_)
+    {
+        size += bucket.objects.size();
     }
+
+    return size;
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Frame Rate Buckets
+//----------------------------------------------------------------------------
+int Animations::buckets() const
+{
+    return buckets_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Awake Objects
+//----------------------------------------------------------------------------
+int Animations::active() const
+{
+    int active = 0;
+
+    for(const Bucket& bucket : buckets_)
+    {
+        active += bucket.awake;
+    }
+
+    return active;
 }
 
 //----------------------------------------------------------------------------
@@ -88,19 +265,356 @@ void Animations::setFrozen(bool frozen)
 //----------------------------------------------------------------------------
 bool Animations::frozen() const
 {
-    frozen_;
+    return frozen_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Maximum Elapsed Time
+//----------------------------------------------------------------------------
+float Animations::getMaxElapsed() const
+{
+    return maxElapsed_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Maximum Elapsed Time
+//----------------------------------------------------------------------------
+// * seconds : most time a single update may advance the clocks by
+//----------------------------------------------------------------------------
+void Animations::setMaxElapsed(float seconds)
+{
+    if(seconds > 0)
+    {
+        maxElapsed_ = seconds;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Maximum Steps per Update
+//----------------------------------------------------------------------------
+int Animations::getMaxSteps() const
+{
+    return maxSteps_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Maximum Steps per Update
+//----------------------------------------------------------------------------
+// * steps : most times a single update may step any one object
+//----------------------------------------------------------------------------
+void Animations::setMaxSteps(int steps)
+{
+    if(steps > 0)
+    {
+        maxSteps_ = steps;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Total Dropped Time
+//----------------------------------------------------------------------------
+// Returns the elapsed time in seconds discarded by the elapsed time limit
+//----------------------------------------------------------------------------
+float Animations::droppedTime() const
+{
+    return droppedTime_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Total Dropped Steps
+//----------------------------------------------------------------------------
+// Returns the number of bucket steps discarded by the steps per update limit
+//----------------------------------------------------------------------------
+long Animations::droppedSteps() const
+{
+    return droppedSteps_;
+}
+
+//----------------------------------------------------------------------------
+// - Parallel Updates?
+//----------------------------------------------------------------------------
+bool Animations::parallel() const
+{
+    return parallel_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Parallel Updates
+//----------------------------------------------------------------------------
+// * parallel : whether concurrent objects are stepped across the thread pool.
+//      Results are identical either way
+//----------------------------------------------------------------------------
+void Animations::setParallel(bool parallel)
+{
+    parallel_ = parallel;
+}
+
+//----------------------------------------------------------------------------
+// - Reset Bucket Clocks
+//----------------------------------------------------------------------------
+// Discards the partial frame every bucket has accumulated, so all buckets next
+// step on the same frame boundaries as they did when first created
+//----------------------------------------------------------------------------
+void Animations::resetClocks()
+{
+    for(Bucket& bucket : buckets_)
+    {
+        bucket.clock = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Concurrent Phase Running?
+//----------------------------------------------------------------------------
+// Returns whether objects are being stepped concurrently, and may not touch
+// shared state
+//----------------------------------------------------------------------------
+bool Animations::concurrent() const
+{
+    return concurrent_;
+}
+
+//----------------------------------------------------------------------------
+// - Defer Signal Emission
+//----------------------------------------------------------------------------
+// * signal : signal emitted by an object during a concurrent phase, to be
+//      emitted once the phase is over, in the order of the objects' slots
+//----------------------------------------------------------------------------
+void Animations::defer(Signal* signal)
+{
+    std::lock_guard<std::mutex> guard(deferredLock_);
+    deferred_.push_back(std::make_pair(stepping, signal));
 }
 
 //----------------------------------------------------------------------------
 // - Update Animations
 //----------------------------------------------------------------------------
+// * elapsed : relative time passed since last update
+// Advances every bucket's clock, stepping its awake, unfrozen objects once per
+// whole frame accumulated. Buckets with no frame due cost nothing beyond the
+// clock, and sleeping objects nothing at all. Elapsed time beyond the maximum
+// and frames beyond the maximum steps are dropped rather than caught up on
+//----------------------------------------------------------------------------
 void Animations::update(float elapsed)
 {
-    Node* node = front_;
+    if(frozen_)
+    {
+        return;
+    }
+
+    if(elapsed > maxElapsed_)
+    {
+        droppedTime_ += elapsed - maxElapsed_;
+        elapsed = maxElapsed_;
+    }
+
+    updating_ = true;
+
+    // Objects registered or woken during this update wait for the next one
+    counts_.resize(buckets_.size());
+    for(int b = 0; b < buckets_.size(); b++)
+    {
+        counts_[b] = buckets_[b].awake;
+    }
+
+    // Buckets are indexed throughout, since steps may register new ones
+    for(int b = 0; b < counts_.size(); b++)
+    {
+        buckets_[b].clock += elapsed * buckets_[b].fps;
+        if(buckets_[b].clock < 1)
+        {
+            continue;
+        }
+
+        int steps = buckets_[b].clock;
+        buckets_[b].clock -= steps;
+
+        if(steps > maxSteps_)
+        {
+            droppedSteps_ += steps - maxSteps_;
+            steps = maxSteps_;
+        }
+
+        for(int s = 0; s < steps; s++)
+        {
+            // Concurrent phase
+            int chunks = (counts_[b] + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+            concurrent_ = true;
+
+            if(parallel_ && chunks > 1 && ThreadPool::instance().size() > 1)
+            {
+                ThreadPool::instance().parallelFor(chunks, [this, b](int c){
+                    stepRange(b, c * PARALLEL_CHUNK, std::min(counts_[b], (c + 1) * PARALLEL_CHUNK), true);
+                });
+            }
+            else
+            {
+                stepRange(b, 0, counts_[b], true);
+            }
+
+            concurrent_ = false;
+
+            if(sleepers_.exchange(false, std::memory_order_relaxed))
+            {
+                buckets_[b].drowsy = true;
+            }
+
+            flush();
+
+            // Serial phase
+            stepRange(b, 0, counts_[b], false);
+        }
+    }
+
+    updating_ = false;
+
+    for(Bucket& bucket : buckets_)
+    {
+        if(bucket.drowsy)
+        {
+            settle(bucket);
+        }
+
+        if(bucket.stale)
+        {
+            compact(bucket);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Step Range of Bucket (private)
+//----------------------------------------------------------------------------
+// * bucket : index of the bucket to step
+// * begin : index of the first slot to step
+// * end : index past the last slot to step
+// * concurrent : steps only concurrent objects if set, otherwise only the rest
+//----------------------------------------------------------------------------
+void Animations::stepRange(int bucket, int begin, int end, bool concurrent)
+{
+    for(int i = begin; i < end; i++)
+    {
+        AnimatedObject* obj = buckets_[bucket].objects[i];
+
+        if(obj && obj->concurrent_ == concurrent && !obj->frozen_ && !obj->sleepy_)
+        {
+            stepping = i;
+            obj->step();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Flush Deferred Signals (private)
+//----------------------------------------------------------------------------
+// Emits the signals deferred by the last concurrent phase in slot order, as
+// they would have been emitted had the phase run on a single thread
+//----------------------------------------------------------------------------
+void Animations::flush()
+{
+    if(deferred_.empty())
+    {
+        return;
+    }
+
+    std::stable_sort(deferred_.begin(), deferred_.end(), [](const std::pair<int, Signal*>& a, const std::pair<int, Signal*>& b){
+        return a.first < b.first;
+    });
+
+    // Emitted outside any concurrent phase, so none are added meanwhile
+    for(const std::pair<int, Signal*>& signal : deferred_)
+    {
+        signal.second->emit();
+    }
+
+    deferred_.clear();
+}
+
+//----------------------------------------------------------------------------
+// - Swap Bucket Slots (private)
+//----------------------------------------------------------------------------
+// * bucket : bucket holding both slots
+// * a : index of the first slot
+// * b : index of the second slot
+// Exchanges the objects of two slots, updating the handles of both
+//----------------------------------------------------------------------------
+void Animations::swap(Bucket& bucket, int a, int b)
+{
+    if(a == b)
+    {
+        return;
+    }
+
+    std::swap(bucket.objects[a], bucket.objects[b]);
+
+    if(bucket.objects[a])
+    {
+        bucket.objects[a]->animIndex_ = a;
+    }
+
+    if(bucket.objects[b])
+    {
+        bucket.objects[b]->animIndex_ = b;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Remove Bucket Slot (private)
+//----------------------------------------------------------------------------
+// * bucket : bucket holding the slot
+// * index : index of the slot to remove
+// Fills an awake slot with the last awake object, then fills the resulting
+// hole with the last object overall, keeping both partitions dense
+//----------------------------------------------------------------------------
+void Animations::removeAt(Bucket& bucket, int index)
+{
+    if(index < bucket.awake)
+    {
+        swap(bucket, index, --bucket.awake);
+        index = bucket.awake;
+    }
 
-    while(node && !frozen_)
+    swap(bucket, index, bucket.objects.size() - 1);
+    bucket.objects.pop_back();
+}
+
+//----------------------------------------------------------------------------
+// - Settle Bucket (private)
+//----------------------------------------------------------------------------
+// * bucket : bucket whose objects put to sleep during the last update are
+//      moved behind the awake ones
+//----------------------------------------------------------------------------
+void Animations::settle(Bucket& bucket)
+{
+    for(int i = bucket.awake - 1; i >= 0; i--)
     {
-        node->getObject()->update(elapsed);
-        node = node->next();
+        AnimatedObject* obj = bucket.objects[i];
+
+        if(obj && obj->sleepy_)
+        {
+            obj->sleepy_ = false;
+            swap(bucket, i, --bucket.awake);
+        }
     }
+
+    bucket.drowsy = false;
 }
+
+//----------------------------------------------------------------------------
+// - Compact Bucket (private)
+//----------------------------------------------------------------------------
+// * bucket : bucket whose slots cleared during the last update are removed
+//----------------------------------------------------------------------------
+void Animations::compact(Bucket& bucket)
+{
+    // Descending order, so slots moved into a hole are always occupied
+    for(int i = bucket.objects.size() - 1; i >= 0; i--)
+    {
+        if(!bucket.objects[i])
+        {
+            removeAt(bucket, i);
+        }
+    }
+
+    bucket.stale = false;
+}
\ No newline at end of file
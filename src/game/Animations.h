@@ -1,14 +1,31 @@
 #ifndef TACTICS_ANIMATIONS_MANAGER_H
 #define TACTICS_ANIMATIONS_MANAGER_H
 
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
 class AnimatedObject;
+class Signal;
 
 //================================================================================
 // ** Animations
 //================================================================================
 // Singleton container for all animated objects which self-register and
-// de-register on destruction. Implements a local single linked list for optimal
-// self-removal and container iteration
+// de-register on destruction. Objects are grouped into buckets by frame rate,
+// each bucket advancing a single shared clock and stepping all its objects
+// together. Buckets hold their objects in a dense array, each object storing
+// its own index as a handle for constant-time swap-removal. The array is
+// partitioned into awake objects followed by sleeping ones, which are never
+// stepped until woken, so idle objects cost nothing per frame. Elapsed time
+// and catch-up steps per update are both bounded, with the excess dropped and
+// counted, so a stall never causes a burst of steps longer than the stall.
+// Each frame of a bucket runs in two phases: concurrent objects, which only
+// touch their own state, are stepped first, across the thread pool if parallel
+// updates are on, then all other objects are stepped in order. Serial updates
+// keep the same phase order, so both modes give identical results. Signals
+// emitted in a concurrent phase are deferred to its end
 //================================================================================
 class Animations
 {
@@ -22,38 +39,63 @@ public:
 
     static Animations&          instance();
     void                        add(AnimatedObject* obj);
+    void                        remove(AnimatedObject* obj);
+    void                        sleep(AnimatedObject* obj);
+    void                        wake(AnimatedObject* obj);
+    bool                        awake(const AnimatedObject* obj) const;
+    int                         size() const;
+    int                         buckets() const;
+    int                         active() const;
     void                        freeze();
     void                        unfreeze();
     void                        setFrozen(bool frozen);
     bool                        frozen() const;
+    float                       getMaxElapsed() const;
+    void                        setMaxElapsed(float seconds);
+    int                         getMaxSteps() const;
+    void                        setMaxSteps(int steps);
+    float                       droppedTime() const;
+    long                        droppedSteps() const;
+    bool                        parallel() const;
+    void                        setParallel(bool parallel);
+    void                        resetClocks();
+    bool                        concurrent() const;
+    void                        defer(Signal* signal);
     void                        update(float elapsed);
 
-// Node Sub-class
-    class Node
+private:
+    // Bucket Sub-structure
+    struct Bucket
     {
-    // Node Methods
-    public:
-        Node(AnimatedObject* obj, Animations* container, Node* prev = 0, Node* next = 0);
-        ~Node();
-
-        Node*                   previous();
-        void                    setPrevious(Node* prev);
-        Node*                   next();
-        void                    setNext(Node* next);
-        AnimatedObject*         getObject();
-        const AnimatedObject*   getObject() const;
-        
-    // Methods
-    private:
-        AnimatedObject*         object_;
-        Node*                   prev_;
-        Node*                   next_;
-        Animations*             container_;
+        float                           fps;
+        float                           clock;
+        std::vector<AnimatedObject*>    objects;
+        int                             awake;
+        bool                            stale;
+        bool                            drowsy;
     };
 
+    void                        flush();
+    void                        stepRange(int bucket, int begin, int end, bool concurrent);
+    void                        swap(Bucket& bucket, int a, int b);
+    void                        removeAt(Bucket& bucket, int index);
+    void                        settle(Bucket& bucket);
+    void                        compact(Bucket& bucket);
+
 // Members
-    Node*                       front_;
+    std::vector<Bucket>         buckets_;
+    std::vector<int>            counts_;
     bool                        frozen_;
+    bool                        updating_;
+    bool                        parallel_;
+    bool                        concurrent_;
+    std::atomic<bool>           sleepers_;
+    std::vector<std::pair<int, Signal*>> deferred_;
+    std::mutex                  deferredLock_;
+    float                       maxElapsed_;
+    int                         maxSteps_;
+    float                       droppedTime_;
+    long                        droppedSteps_;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "Coverage.h"
+#include "ThreadPool.h"
+#include "../map/Map.h"
+#include "../objects/Actor.h"
+#include <algorithm>
+#include <math.h>
+
+//----------------------------------------------------------------------------
+// - Coverage Constructor
+//----------------------------------------------------------------------------
+Coverage::Coverage()
+{}
+
+//----------------------------------------------------------------------------
+// - Coverage Destructor
+//----------------------------------------------------------------------------
+Coverage::~Coverage()
+{}
+
+//----------------------------------------------------------------------------
+// - Compute Coverage
+//----------------------------------------------------------------------------
+// * map : map the actors stand on
+// * actors : every actor whose reach and threat is computed
+// * parallel : spreads actors over the thread pool if set
+// Actors bound by non-standard movement rules are computed up front on the
+// calling thread, since their rules may read any state; all others only read
+// the snapshots taken here
+//----------------------------------------------------------------------------
+void Coverage::compute(const Map& map, const std::vector<Actor*>& actors, bool parallel)
+{
+    terrain_ = map.getTerrain();
+    entries_.clear();
+
+    for(int c = 0; c < map.movementClasses(); c++)
+    {
+        entries_.insert(entries_.end(), map.getEntries(c), map.getEntries(c) + 4);
+    }
+
+    occupancy_ = map.getOccupancy();
+    empty_ = BitGrid(terrain_.width(), terrain_.height());
+
+    actorReach_.assign(actors.size(), empty_);
+    actorThreat_.assign(actors.size(), empty_);
+
+    std::vector<int> standard;
+    int teams = 0;
+
+    for(int i = 0; i < actors.size(); i++)
+    {
+        teams = std::max(teams, actors[i]->getTeam() + 1);
+
+        if(actors[i]->standardRules())
+        {
+            standard.push_back(i);
+        }
+        else
+        {
+            for(const sf::Vector2f& position : actors[i]->reach())
+            {
+                actorReach_[i].set(position.x, position.y);
+            }
+            computeActor(*actors[i], i);
+        }
+    }
+
+    std::function<void(int)> task = [&](int s){
+        int i = standard[s];
+
+        int movementClass = actors[i]->getMovementClass();
+
+        if(movementClass >= map.movementClasses())
+        {
+            movementClass = 0;
+        }
+
+        actorReach_[i] = actors[i]->reach(&entries_[movementClass * 4], occupancy_);
+        computeActor(*actors[i], i);
+    };
+
+    if(parallel)
+    {
+        ThreadPool::instance().parallelFor(standard.size(), task);
+    }
+    else
+    {
+        for(int s = 0; s < standard.size(); s++)
+        {
+            task(s);
+        }
+    }
+
+    // Merge into team grids
+    teamReach_.assign(teams, empty_);
+    teamThreat_.assign(teams, empty_);
+
+    for(int i = 0; i < actors.size(); i++)
+    {
+        teamReach_[actors[i]->getTeam()].merge(actorReach_[i]);
+        teamThreat_[actors[i]->getTeam()].merge(actorThreat_[i]);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Teams
+//----------------------------------------------------------------------------
+int Coverage::teams() const
+{
+    return teamReach_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Get Team Reach
+//----------------------------------------------------------------------------
+// * team : index of the team
+// Returns the positions any actor of the team can move to
+//----------------------------------------------------------------------------
+const BitGrid& Coverage::reach(int team) const
+{
+    if(team < 0 || team >= teamReach_.size())
+    {
+        return empty_;
+    }
+
+    return teamReach_[team];
+}
+
+//----------------------------------------------------------------------------
+// - Get Team Threat
+//----------------------------------------------------------------------------
+// * team : index of the team
+// Returns the positions any actor of the team can strike this turn
+//----------------------------------------------------------------------------
+const BitGrid& Coverage::threat(int team) const
+{
+    if(team < 0 || team >= teamThreat_.size())
+    {
+        return empty_;
+    }
+
+    return teamThreat_[team];
+}
+
+//----------------------------------------------------------------------------
+// - Get Actor Reach
+//----------------------------------------------------------------------------
+// * index : index of the actor in the last computed batch
+//----------------------------------------------------------------------------
+const BitGrid& Coverage::actorReach(int index) const
+{
+    if(index < 0 || index >= actorReach_.size())
+    {
+        return empty_;
+    }
+
+    return actorReach_[index];
+}
+
+//----------------------------------------------------------------------------
+// - Get Actor Threat
+//----------------------------------------------------------------------------
+// * index : index of the actor in the last computed batch
+//----------------------------------------------------------------------------
+const BitGrid& Coverage::actorThreat(int index) const
+{
+    if(index < 0 || index >= actorThreat_.size())
+    {
+        return empty_;
+    }
+
+    return actorThreat_[index];
+}
+
+//----------------------------------------------------------------------------
+// - Compute Actor Threat (protected)
+//----------------------------------------------------------------------------
+// * actor : actor whose reach has already been stored
+// * index : index of the actor in the batch
+// Spreads the actor's reach and standing position by its longest skill range
+//----------------------------------------------------------------------------
+void Coverage::computeActor(const Actor& actor, int index)
+{
+    int range = 0;
+
+    for(const Skill* skill : actor.getSkills())
+    {
+        range = std::max(range, skill->maxRange());
+    }
+
+    BitGrid& threat = actorThreat_[index];
+
+    if(range == 0)
+    {
+        threat.clear();
+        return;
+    }
+
+    threat = actorReach_[index];
+    threat.set(round(actor.position().x), round(actor.position().y));
+    threat.spread(terrain_, range);
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#ifndef TACTICS_COVERAGE_H
+#define TACTICS_COVERAGE_H
+
+#include "../map/BitGrid.h"
+#include <vector>
+
+class Actor;
+class Map;
+
+//================================================================================
+// ** Coverage
+//================================================================================
+// Batch computation of the reach and threat of every actor on a map, merged
+// into per-team grids. Reach is the set of positions an actor can move to, and
+// threat the set of positions it can strike from any of them (or from where it
+// stands). Actors are processed in parallel against snapshots of the map's
+// terrain, passability edge and occupancy grids
+//================================================================================
+class Coverage
+{
+// Methods
+public:
+    Coverage();
+    virtual ~Coverage();
+
+    void                    compute(const Map& map, const std::vector<Actor*>& actors, bool parallel = true);
+    int                     teams() const;
+    const BitGrid&          reach(int team) const;
+    const BitGrid&          threat(int team) const;
+    const BitGrid&          actorReach(int index) const;
+    const BitGrid&          actorThreat(int index) const;
+
+protected:
+    void                    computeActor(const Actor& actor, int index);
+
+// Members
+    BitGrid                 terrain_;
+    std::vector<BitGrid>    entries_;
+    BitGrid                 occupancy_;
+    std::vector<BitGrid>    actorReach_;
+    std::vector<BitGrid>    actorThreat_;
+    std::vector<BitGrid>    teamReach_;
+    std::vector<BitGrid>    teamThreat_;
+    BitGrid                 empty_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "DrawList.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+// - Draw List Constructor
+//----------------------------------------------------------------------------
+// * size : size of the target the list is played onto, setting up its
+//      default view
+//----------------------------------------------------------------------------
+DrawList::DrawList(const sf::Vector2u& size) :
+    size_(size),
+    used_(0)
+{
+    initialize();
+}
+
+//----------------------------------------------------------------------------
+// - Draw List Copy Constructor (private, empty)
+//----------------------------------------------------------------------------
+DrawList::DrawList(const DrawList& copy)
+{}
+
+//----------------------------------------------------------------------------
+// - Draw List Destructor
+//----------------------------------------------------------------------------
+DrawList::~DrawList()
+{}
+
+//----------------------------------------------------------------------------
+// - Submit Sprite
+//----------------------------------------------------------------------------
+// * target : target the sprite is drawn onto, or recorded by if a draw list
+// * sprite : sprite to draw
+// * states : render states the sprite is drawn with
+//----------------------------------------------------------------------------
+void DrawList::submit(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+{
+    DrawList* list = dynamic_cast<DrawList*>(&target);
+
+    if(!list)
+    {
+        target.draw(sprite, states);
+        return;
+    }
+
+    if(!sprite.getTexture())
+    {
+        return;
+    }
+
+    sf::Transform transform = states.transform * sprite.getTransform();
+    sf::FloatRect bounds = sprite.getLocalBounds();
+    const sf::IntRect& rect = sprite.getTextureRect();
+    float u1 = rect.left, v1 = rect.top, u2 = rect.left + rect.width, v2 = rect.top + rect.height;
+
+    sf::Vertex* quad = list->add(4, sf::Quads, sf::RenderStates(states.blendMode, sf::Transform::Identity, sprite.getTexture(), 0));
+    quad[0] = sf::Vertex(transform.transformPoint(0, 0), sprite.getColor(), sf::Vector2f(u1, v1));
+    quad[1] = sf::Vertex(transform.transformPoint(bounds.width, 0), sprite.getColor(), sf::Vector2f(u2, v1));
+    quad[2] = sf::Vertex(transform.transformPoint(bounds.width, bounds.height), sprite.getColor(), sf::Vector2f(u2, v2));
+    quad[3] = sf::Vertex(transform.transformPoint(0, bounds.height), sprite.getColor(), sf::Vector2f(u1, v2));
+}
+
+//----------------------------------------------------------------------------
+// - Submit Shape
+//----------------------------------------------------------------------------
+// * target : target the shape is drawn onto, or recorded by if a draw list
+// * shape : convex shape to draw, of which only the fill is recorded
+// * states : render states the shape is drawn with
+// Shapes of four points are recorded as quads, others as a fan of triangles
+//----------------------------------------------------------------------------
+void DrawList::submit(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+{
+    DrawList* list = dynamic_cast<DrawList*>(&target);
+
+    if(!list)
+    {
+        target.draw(shape, states);
+        return;
+    }
+
+    int points = shape.getPointCount();
+
+    if(points < 3)
+    {
+        return;
+    }
+
+    sf::Transform transform = states.transform * shape.getTransform();
+    sf::FloatRect bounds = shape.getLocalBounds();
+    const sf::IntRect& rect = shape.getTextureRect();
+
+    // Texture coordinates stretch the texture rectangle over the bounds
+    auto vertex = [&](int point){
+        sf::Vector2f position = shape.getPoint(point);
+        float u = bounds.width > 0 ? (position.x - bounds.left) / bounds.width : 0;
+        float v = bounds.height > 0 ? (position.y - bounds.top) / bounds.height : 0;
+
+        return sf::Vertex(transform.transformPoint(position), shape.getFillColor(),
+            sf::Vector2f(rect.left + rect.width * u, rect.top + rect.height * v));
+    };
+
+    sf::RenderStates recorded(states.blendMode, sf::Transform::Identity, shape.getTexture(), 0);
+
+    if(points == 4)
+    {
+        sf::Vertex* quad = list->add(4, sf::Quads, recorded);
+
+        for(int i = 0; i < 4; i++)
+        {
+            quad[i] = vertex(i);
+        }
+    }
+    else
+    {
+        sf::Vertex* triangles = list->add((points - 2) * 3, sf::Triangles, recorded);
+
+        for(int i = 1; i < points - 1; i++)
+        {
+            *triangles++ = vertex(0);
+            *triangles++ = vertex(i);
+            *triangles++ = vertex(i + 1);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Submit Vertex Array
+//----------------------------------------------------------------------------
+// * target : target the vertices are drawn onto, or recorded by if a draw list
+// * vertices : vertex array to draw
+// * states : render states the vertices are drawn with
+//----------------------------------------------------------------------------
+void DrawList::submit(sf::RenderTarget& target, const sf::VertexArray& vertices, const sf::RenderStates& states)
+{
+    DrawList* list = dynamic_cast<DrawList*>(&target);
+
+    if(!list)
+    {
+        target.draw(vertices, states);
+        return;
+    }
+
+    int count = vertices.getVertexCount();
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    sf::Vertex* recorded = list->add(count, vertices.getPrimitiveType(), sf::RenderStates(states.blendMode, sf::Transform::Identity, states.texture, 0));
+
+    for(int i = 0; i < count; i++)
+    {
+        recorded[i] = vertices[i];
+        recorded[i].position = states.transform.transformPoint(vertices[i].position);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Is Recording?
+//----------------------------------------------------------------------------
+// * target : target being drawn onto
+// Returns whether the target is a draw list, only recording what is drawn
+//----------------------------------------------------------------------------
+bool DrawList::recording(const sf::RenderTarget& target)
+{
+    return dynamic_cast<const DrawList*>(&target) != 0;
+}
+
+//----------------------------------------------------------------------------
+// - Reset List
+//----------------------------------------------------------------------------
+// Drops everything recorded, keeping the storage, and returns to the default
+// view
+//----------------------------------------------------------------------------
+void DrawList::reset()
+{
+    commands_.clear();
+    views_.clear();
+    used_ = 0;
+
+    setView(getDefaultView());
+}
+
+//----------------------------------------------------------------------------
+// - Play List
+//----------------------------------------------------------------------------
+// * target : target to draw the recorded frame onto, through the recorded
+//      views. The target is left with the last of them
+//----------------------------------------------------------------------------
+void DrawList::play(sf::RenderTarget& target) const
+{
+    int view = -1;
+
+    for(const Command& command : commands_)
+    {
+        if(command.view != view)
+        {
+            view = command.view;
+            target.setView(views_[view]);
+        }
+
+        target.draw(&vertices_[command.first], command.count, command.type, sf::RenderStates(command.blendMode, sf::Transform::Identity, command.texture, 0));
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Command Count
+//----------------------------------------------------------------------------
+// Returns the number of draw calls playing the list takes
+//----------------------------------------------------------------------------
+int DrawList::commands() const
+{
+    return commands_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Get Vertex Count
+//----------------------------------------------------------------------------
+int DrawList::vertices() const
+{
+    return used_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Size (Override)
+//----------------------------------------------------------------------------
+sf::Vector2u DrawList::getSize() const
+{
+    return size_;
+}
+
+//----------------------------------------------------------------------------
+// - Add Vertices (protected)
+//----------------------------------------------------------------------------
+// * count : number of vertices to record
+// * type : primitive the vertices form
+// * states : texture and blend mode the vertices are drawn with
+// Returns the vertices to fill in, valid until the next addition. They join
+// the last command if it has the same texture, blend mode and view, and the
+// primitive is not a strip or fan, which could not be joined
+//----------------------------------------------------------------------------
+sf::Vertex* DrawList::add(int count, sf::PrimitiveType type, const sf::RenderStates& states)
+{
+    const sf::View& current = getView();
+
+    if(views_.empty() || views_.back().getCenter() != current.getCenter() || views_.back().getSize() != current.getSize()
+        || views_.back().getRotation() != current.getRotation() || views_.back().getViewport() != current.getViewport())
+    {
+        views_.push_back(current);
+    }
+
+    int view = views_.size() - 1;
+    bool joinable = type != sf::LineStrip && type != sf::TriangleStrip && type != sf::TriangleFan;
+
+    if(joinable && !commands_.empty() && commands_.back().type == type && commands_.back().texture == states.texture
+        && commands_.back().blendMode == states.blendMode && commands_.back().view == view)
+    {
+        commands_.back().count += count;
+    }
+    else
+    {
+        commands_.push_back(Command{states.texture, states.blendMode, type, view, used_, count});
+    }
+
+    if(used_ + count > vertices_.size())
+    {
+        vertices_.resize(std::max<size_t>(vertices_.size() * 2, used_ + count));
+    }
+
+    sf::Vertex* added = &vertices_[used_];
+    used_ += count;
+
+    return added;
+}
+
+//----------------------------------------------------------------------------
+// - Activate (Override, private)
+//----------------------------------------------------------------------------
+// Recording needs no GL context. Anything drawn onto the list without being
+// submitted is dropped
+//----------------------------------------------------------------------------
+bool DrawList::activate(bool active)
+{
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef TACTICS_DRAW_LIST_H
+#define TACTICS_DRAW_LIST_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+//================================================================================
+// ** DrawList
+//================================================================================
+// Render target recording a frame instead of drawing it, so it can be played
+// back later, on another thread. Drawables draw into it as into any target;
+// their sprites, shapes and vertex arrays are submitted with DrawList::submit,
+// which records them when the target is a draw list, or draws them otherwise.
+// Each is recorded as vertices already transformed into the coordinates of
+// the view it was drawn through, in commands of the texture, blend mode and
+// view they share, consecutive quads with the same ones joining a single
+// command. A recorded list holds no reference to the drawables themselves, so
+// they may change while it plays. Lists keep their storage when reset, so
+// recording frames of a similar size never allocates
+//================================================================================
+class DrawList : public sf::RenderTarget
+{
+// Methods
+private:
+    DrawList(const DrawList&);
+
+public:
+    DrawList(const sf::Vector2u& size);
+    virtual ~DrawList();
+
+    static void             submit(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void             submit(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void             submit(sf::RenderTarget& target, const sf::VertexArray& vertices, const sf::RenderStates& states = sf::RenderStates::Default);
+    static bool             recording(const sf::RenderTarget& target);
+
+    void                    reset();
+    void                    play(sf::RenderTarget& target) const;
+    int                     commands() const;
+    int                     vertices() const;
+    virtual sf::Vector2u    getSize() const;
+
+protected:
+    sf::Vertex*             add(int count, sf::PrimitiveType type, const sf::RenderStates& states);
+
+private:
+    virtual bool            activate(bool active);
+
+    // Command Sub-structure
+    struct Command
+    {
+        const sf::Texture*  texture;
+        sf::BlendMode       blendMode;
+        sf::PrimitiveType   type;
+        int                 view;
+        int                 first;
+        int                 count;
+    };
+
+// Members
+    sf::Vector2u            size_;
+    std::vector<sf::Vertex> vertices_;
+    std::vector<Command>    commands_;
+    std::vector<sf::View>   views_;
+    int                     used_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "GlyphAtlas.h"
+#include "Simulation.h"
+#include <algorithm>
+
+// Width of the glyph texture, and the blank border kept around each glyph
+static const unsigned GLYPH_ATLAS_WIDTH = 512;
+static const unsigned GLYPH_PADDING = 1;
+
+//----------------------------------------------------------------------------
+// - Glyph Atlas Constructor (private)
+//----------------------------------------------------------------------------
+GlyphAtlas::GlyphAtlas() :
+    loaded_(false),
+    x_(0),
+    y_(0),
+    shelf_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Glyph Atlas Destructor
+//----------------------------------------------------------------------------
+GlyphAtlas::~GlyphAtlas()
+{
+    for(Face* face : faces_)
+    {
+        delete face;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Instance
+//----------------------------------------------------------------------------
+GlyphAtlas& GlyphAtlas::instance()
+{
+    static GlyphAtlas instance;
+    return instance;
+}
+
+//----------------------------------------------------------------------------
+// - Get Face
+//----------------------------------------------------------------------------
+// * size : character size in pixels
+// * bold : whether the face is emboldened
+// Rasterizes the face the first time it is requested. The font is loaded on
+// the first request outside of a headless simulation, filling in any faces
+// left empty before then
+//----------------------------------------------------------------------------
+const GlyphAtlas::Face& GlyphAtlas::face(unsigned size, bool bold)
+{
+    if(!loaded_ && !Simulation::headless() && font_.loadFromFile("resources/fonts/Arial.ttf"))
+    {
+        loaded_ = true;
+
+        for(Face* face : faces_)
+        {
+            rasterize(*face);
+        }
+    }
+
+    for(Face* face : faces_)
+    {
+        if(face->size == size && face->bold == bold)
+        {
+            return *face;
+        }
+    }
+
+    Face* face = new Face;
+    face->size = size;
+    face->bold = bold;
+    face->lineSpacing = 0;
+    faces_.push_back(face);
+
+    rasterize(*face);
+
+    return *face;
+}
+
+//----------------------------------------------------------------------------
+// - Get Kerning
+//----------------------------------------------------------------------------
+// * face : face the characters are set in
+// * first, second : consecutive characters
+// Returns the offset to apply to the pen between the characters
+//----------------------------------------------------------------------------
+float GlyphAtlas::kerning(const Face& face, char first, char second) const
+{
+    return loaded_ ? font_.getKerning(first, second, face.size) : 0;
+}
+
+//----------------------------------------------------------------------------
+// - Measure Text
+//----------------------------------------------------------------------------
+// * text : single line of text
+// * size : character size in pixels
+// * bold : whether the text is emboldened
+// Returns the width the pen advances through the text
+//----------------------------------------------------------------------------
+float GlyphAtlas::measure(const std::string& text, unsigned size, bool bold)
+{
+    const Face& measured = face(size, bold);
+    float width = 0;
+
+    for(int i = 0; i < text.size(); i++)
+    {
+        if(i > 0)
+        {
+            width += kerning(measured, text[i - 1], text[i]);
+        }
+
+        width += measured.glyph(text[i]).advance;
+    }
+
+    return width;
+}
+
+//----------------------------------------------------------------------------
+// - Get Texture
+//----------------------------------------------------------------------------
+const sf::Texture& GlyphAtlas::getTexture() const
+{
+    return texture_;
+}
+
+//----------------------------------------------------------------------------
+// - Rasterize Face (protected)
+//----------------------------------------------------------------------------
+// * face : face whose glyphs are rendered by the font, then copied with a
+//      blank border into the shared texture in shelves, growing it as needed
+//----------------------------------------------------------------------------
+void GlyphAtlas::rasterize(Face& face)
+{
+    if(!loaded_)
+    {
+        return;
+    }
+
+    for(int i = 0; i < GLYPH_COUNT; i++)
+    {
+        face.glyphs[i] = font_.getGlyph(GLYPH_FIRST + i, face.size, face.bold);
+    }
+
+    face.lineSpacing = font_.getLineSpacing(face.size);
+
+    // The font's own page is read back once all glyphs are on it
+    sf::Image page = font_.getTexture(face.size).copyToImage();
+
+    for(int i = 0; i < GLYPH_COUNT; i++)
+    {
+        sf::IntRect& rect = face.glyphs[i].textureRect;
+
+        if(rect.width <= 0 || rect.height <= 0)
+        {
+            continue;
+        }
+
+        unsigned w = rect.width + GLYPH_PADDING * 2, h = rect.height + GLYPH_PADDING * 2;
+
+        if(x_ + w > GLYPH_ATLAS_WIDTH)
+        {
+            x_ = 0;
+            y_ += shelf_;
+            shelf_ = 0;
+        }
+
+        if(y_ + h > image_.getSize().y)
+        {
+            unsigned height = image_.getSize().y ? image_.getSize().y : 128;
+            while(y_ + h > height)
+            {
+                height *= 2;
+            }
+
+            sf::Image grown;
+            grown.create(GLYPH_ATLAS_WIDTH, height, sf::Color::Transparent);
+            if(image_.getSize().y > 0)
+            {
+                grown.copy(image_, 0, 0);
+            }
+            image_ = grown;
+        }
+
+        // Font pages keep a blank border around glyphs too, copied along
+        image_.copy(page, x_, y_, sf::IntRect(rect.left - GLYPH_PADDING, rect.top - GLYPH_PADDING, w, h));
+        rect = sf::IntRect(x_ + GLYPH_PADDING, y_ + GLYPH_PADDING, rect.width, rect.height);
+
+        x_ += w;
+        shelf_ = std::max(shelf_, h);
+    }
+
+    texture_.loadFromImage(image_);
+}
+
+//----------------------------------------------------------------------------
+// - Get Glyph
+//----------------------------------------------------------------------------
+// * character : character to look up, shown as '?' if not printable ASCII
+//----------------------------------------------------------------------------
+const sf::Glyph& GlyphAtlas::Face::glyph(char character) const
+{
+    int index = (unsigned char)character - GLYPH_FIRST;
+
+    if(index < 0 || index >= GLYPH_COUNT)
+    {
+        index = '?' - GLYPH_FIRST;
+    }
+
+    return glyphs[index];
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef TACTICS_GLYPH_ATLAS_H
+#define TACTICS_GLYPH_ATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+// Printable ASCII characters rasterized for every face; others show as '?'
+static const int GLYPH_FIRST = 32;
+static const int GLYPH_COUNT = 95;
+
+//================================================================================
+// ** GlyphAtlas
+//================================================================================
+// Singleton font service loading the game's font once, and rasterizing each
+// face (character size and weight) in use into a single shared texture the
+// first time it is requested. Glyph metrics are kept per face in flat arrays,
+// so laying out text needs neither the font nor any allocation. Faces added
+// later extend the texture downward, leaving existing glyphs in place.
+// Headless simulations load no font, and every glyph is empty
+//================================================================================
+class GlyphAtlas
+{
+// Methods
+private:
+    GlyphAtlas();
+    GlyphAtlas(const GlyphAtlas&);
+
+public:
+    ~GlyphAtlas();
+
+    // Face Sub-structure
+    struct Face
+    {
+        unsigned                size;
+        bool                    bold;
+        float                   lineSpacing;
+        sf::Glyph               glyphs[GLYPH_COUNT];
+
+        const sf::Glyph&        glyph(char character) const;
+    };
+
+    static GlyphAtlas&      instance();
+    const Face&             face(unsigned size, bool bold = false);
+    float                   kerning(const Face& face, char first, char second) const;
+    float                   measure(const std::string& text, unsigned size, bool bold = false);
+    const sf::Texture&      getTexture() const;
+
+protected:
+    void                    rasterize(Face& face);
+
+// Members
+    sf::Font                font_;
+    bool                    loaded_;
+    std::vector<Face*>      faces_;
+    sf::Image               image_;
+    sf::Texture             texture_;
+    unsigned                x_;
+    unsigned                y_;
+    unsigned                shelf_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef TACTICS_INLINE_FUNCTION_H
+#define TACTICS_INLINE_FUNCTION_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature, int Capacity>
+class InlineFunction;
+
+//================================================================================
+// ** InlineFunction
+//================================================================================
+// Move-only callable wrapper storing its target inside a fixed-capacity buffer,
+// so wrapping and moving callables never allocates. Targets larger than the
+// capacity are rejected at compile time
+//================================================================================
+template <typename Result, typename... Args, int Capacity>
+class InlineFunction<Result(Args...), Capacity>
+{
+// Methods
+public:
+    InlineFunction();
+    template <typename Callable, typename = typename std::enable_if<!std::is_same<typename std::decay<Callable>::type, InlineFunction>::value>::type>
+    InlineFunction(Callable&& callable);
+    InlineFunction(InlineFunction&& other);
+    InlineFunction(const InlineFunction& copy) = delete;
+    ~InlineFunction();
+
+    InlineFunction&     operator=(InlineFunction&& other);
+    InlineFunction&     operator=(const InlineFunction& copy) = delete;
+    Result              operator()(Args... args) const;
+    explicit            operator bool() const;
+    void                reset();
+
+private:
+    typedef Result      (*Invoker)(void* target, Args... args);
+    typedef void        (*Mover)(void* destination, void* source);
+    typedef void        (*Destroyer)(void* target);
+
+    template <typename Callable>
+    static Result       invoke(void* target, Args... args);
+    template <typename Callable>
+    static void         move(void* destination, void* source);
+    template <typename Callable>
+    static void         destroy(void* target);
+
+// Members
+    alignas(std::max_align_t) mutable unsigned char storage_[Capacity];
+    Invoker             invoke_;
+    Mover               move_;
+    Destroyer           destroy_;
+};
+
+#include "InlineFunction.inl"
+
+#endif
\ No newline at end of file
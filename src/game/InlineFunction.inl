@@ -0,0 +1,156 @@
+//----------------------------------------------------------------------------
+// - Inline Function Constructor (Empty)
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+InlineFunction<Result(Args...), Capacity>::InlineFunction() :
+    invoke_(0),
+    move_(0),
+    destroy_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Inline Function Constructor
+//----------------------------------------------------------------------------
+// * callable : target moved or copied into the inline buffer
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+template <typename Callable, typename>
+InlineFunction<Result(Args...), Capacity>::InlineFunction(Callable&& callable) :
+    invoke_(&InlineFunction::invoke<typename std::decay<Callable>::type>),
+    move_(&InlineFunction::move<typename std::decay<Callable>::type>),
+    destroy_(&InlineFunction::destroy<typename std::decay<Callable>::type>)
+{
+    typedef typename std::decay<Callable>::type Target;
+
+    static_assert(sizeof(Target) <= Capacity, "callable is too large for the inline function's capacity");
+    static_assert(alignof(Target) <= alignof(std::max_align_t), "callable is over-aligned for an inline function");
+
+    new (storage_) Target(std::forward<Callable>(callable));
+}
+
+//----------------------------------------------------------------------------
+// - Inline Function Move Constructor
+//----------------------------------------------------------------------------
+// * other : function whose target is moved here, leaving it empty
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+InlineFunction<Result(Args...), Capacity>::InlineFunction(InlineFunction&& other) :
+    invoke_(other.invoke_),
+    move_(other.move_),
+    destroy_(other.destroy_)
+{
+    if(move_)
+    {
+        move_(storage_, other.storage_);
+        other.invoke_ = 0;
+        other.move_ = 0;
+        other.destroy_ = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Inline Function Destructor
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+InlineFunction<Result(Args...), Capacity>::~InlineFunction()
+{
+    reset();
+}
+
+//----------------------------------------------------------------------------
+// - Move Assignment
+//----------------------------------------------------------------------------
+// * other : function whose target is moved here, leaving it empty
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+InlineFunction<Result(Args...), Capacity>& InlineFunction<Result(Args...), Capacity>::operator=(InlineFunction&& other)
+{
+    if(this != &other)
+    {
+        reset();
+
+        if(other.move_)
+        {
+            other.move_(storage_, other.storage_);
+            invoke_ = other.invoke_;
+            move_ = other.move_;
+            destroy_ = other.destroy_;
+            other.invoke_ = 0;
+            other.move_ = 0;
+            other.destroy_ = 0;
+        }
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+// - Call Target
+//----------------------------------------------------------------------------
+// * args : arguments forwarded to the target, which must not be empty
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+Result InlineFunction<Result(Args...), Capacity>::operator()(Args... args) const
+{
+    return invoke_(storage_, std::forward<Args>(args)...);
+}
+
+//----------------------------------------------------------------------------
+// - Has Target?
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+InlineFunction<Result(Args...), Capacity>::operator bool() const
+{
+    return invoke_ != 0;
+}
+
+//----------------------------------------------------------------------------
+// - Reset to Empty
+//----------------------------------------------------------------------------
+// Destroys the target, releasing anything it captured
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+void InlineFunction<Result(Args...), Capacity>::reset()
+{
+    if(destroy_)
+    {
+        destroy_(storage_);
+        invoke_ = 0;
+        move_ = 0;
+        destroy_ = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Invoke Target (private)
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+template <typename Callable>
+Result InlineFunction<Result(Args...), Capacity>::invoke(void* target, Args... args)
+{
+    return (*static_cast<Callable*>(target))(std::forward<Args>(args)...);
+}
+
+//----------------------------------------------------------------------------
+// - Move Target (private)
+//----------------------------------------------------------------------------
+// * destination : uninitialized buffer the target is moved into
+// * source : buffer of the target, destroyed once moved
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+template <typename Callable>
+void InlineFunction<Result(Args...), Capacity>::move(void* destination, void* source)
+{
+    new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+    static_cast<Callable*>(source)->~Callable();
+}
+
+//----------------------------------------------------------------------------
+// - Destroy Target (private)
+//----------------------------------------------------------------------------
+template <typename Result, typename... Args, int Capacity>
+template <typename Callable>
+void InlineFunction<Result(Args...), Capacity>::destroy(void* target)
+{
+    static_cast<Callable*>(target)->~Callable();
+}
\ No newline at end of file
@@ -7,15 +7,19 @@
 //----------------------------------------------------------------------------
 InputManager::InputManager() :
     AnimatedObject(FPS / 6),
+    source_(&keyboard_),
     delay_(0),
-    throttle_(ceil(15 * getFPS() / FPS))
+    throttle_(ceil(15 * getFPS() / FPS)),
+    frame_(0)
 {}
 
 //----------------------------------------------------------------------------
 // - Input Manager Constructor (private, empty)
 //----------------------------------------------------------------------------
 InputManager::InputManager(const InputManager&) :
-    throttle_(0)
+    source_(0),
+    throttle_(0),
+    frame_(0)
 {}
 
 //----------------------------------------------------------------------------
@@ -48,6 +52,7 @@ void InputManager::push(InputHandler* handler)
     }
     handlerStack_.push(handler);
     handlerStack_.top()->setActive(true);
+    wake();
 }
 
 //----------------------------------------------------------------------------
@@ -112,10 +117,48 @@ InputHandler* InputManager::getHandler() const
     }
 }
 
+//----------------------------------------------------------------------------
+// - Get Handler Count
+//----------------------------------------------------------------------------
+int InputManager::size() const
+{
+    return handlerStack_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Count
+//----------------------------------------------------------------------------
+// Returns the number of input frames stepped so far, which pause while no
+// handler is pushed
+//----------------------------------------------------------------------------
+unsigned long InputManager::frame() const
+{
+    return frame_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Input Source
+//----------------------------------------------------------------------------
+InputSource& InputManager::getSource()
+{
+    return *source_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Input Source
+//----------------------------------------------------------------------------
+// * source : source handlers read keys from; 0 restores the live keyboard
+//----------------------------------------------------------------------------
+void InputManager::setSource(InputSource* source)
+{
+    source_ = source ? source : &keyboard_;
+}
+
 //----------------------------------------------------------------------------
 // - Poll Current Handler
 //----------------------------------------------------------------------------
-// Signals the top handler to poll for input events
+// Signals the top handler to poll for input events, then advances the input
+// source past the poll
 //----------------------------------------------------------------------------
 void InputManager::poll()
 {
@@ -124,6 +167,7 @@ void InputManager::poll()
         if(!handlerStack_.top()->busy() && handlerStack_.top()->active())
         {
             handlerStack_.top()->poll();
+            source_->advance();
         }
     }
 }
@@ -133,7 +177,14 @@ void InputManager::poll()
 //----------------------------------------------------------------------------
 void InputManager::step()
 {
+    frame_++;
     poll();
 
     if(delay_ > 0) delay_--;
+
+    // Idle until a handler is pushed
+    if(handlerStack_.empty())
+    {
+        sleep();
+    }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define TACTICS_INPUT_MANAGER_H
 
 #include "../control/InputHandler.h"
+#include "../control/KeyboardInput.h"
 #include "../objects/AnimatedObject.h"
 #include <stack>
 
@@ -9,7 +10,8 @@
 // ** InputManager
 //================================================================================
 // Singleton stack of input handling objects. Hides lower handlers on push,
-// revealing them again when the higher handler is popped
+// revealing them again when the higher handler is popped. Handlers read keys
+// from the current input source, the live keyboard unless replaced
 //================================================================================
 class InputManager : public AnimatedObject
 {
@@ -27,6 +29,10 @@ public:
     void                    popTo(InputHandler* handler);
     void                    clear();
     InputHandler*           getHandler() const;
+    int                     size() const;
+    unsigned long           frame() const;
+    InputSource&            getSource();
+    void                    setSource(InputSource* source);
 
 protected:
     void                    poll();
@@ -35,8 +41,11 @@ protected:
 // Members
 private:
     std::stack<InputHandler*>   handlerStack_;
+    KeyboardInput           keyboard_;
+    InputSource*            source_;
     int                     delay_;
     const int               throttle_;
+    unsigned long           frame_;
 };
 
 #endif
\ No newline at end of file
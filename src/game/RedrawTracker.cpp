@@ -0,0 +1,59 @@
+#include "RedrawTracker.h"
+
+//----------------------------------------------------------------------------
+// - Redraw Tracker Constructor (private)
+//----------------------------------------------------------------------------
+// The first frame is always drawn
+//----------------------------------------------------------------------------
+RedrawTracker::RedrawTracker() :
+    pending_(true)
+{}
+
+//----------------------------------------------------------------------------
+// - Redraw Tracker Copy Constructor (private, empty)
+//----------------------------------------------------------------------------
+RedrawTracker::RedrawTracker(const RedrawTracker& copy)
+{}
+
+//----------------------------------------------------------------------------
+// - Redraw Tracker Destructor
+//----------------------------------------------------------------------------
+RedrawTracker::~RedrawTracker()
+{}
+
+//----------------------------------------------------------------------------
+// - Get Instance
+//----------------------------------------------------------------------------
+RedrawTracker& RedrawTracker::instance()
+{
+    static RedrawTracker instance;
+    return instance;
+}
+
+//----------------------------------------------------------------------------
+// - Request Redraw
+//----------------------------------------------------------------------------
+// Marks the screen as out of date, drawing it again on the next frame
+//----------------------------------------------------------------------------
+void RedrawTracker::request()
+{
+    pending_.store(true, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// - Redraw Pending?
+//----------------------------------------------------------------------------
+bool RedrawTracker::pending() const
+{
+    return pending_.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// - Take Request
+//----------------------------------------------------------------------------
+// Returns whether a redraw was requested, clearing the request
+//----------------------------------------------------------------------------
+bool RedrawTracker::take()
+{
+    return pending_.exchange(false, std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef TACTICS_REDRAW_TRACKER_H
+#define TACTICS_REDRAW_TRACKER_H
+
+#include <atomic>
+
+//================================================================================
+// ** RedrawTracker
+//================================================================================
+// Singleton flag raised by anything that changes what is on screen: a re-sort
+// of the depth buffer, an object moving, a sprite changing frame, a view effect
+// or a change to the HUD and menus. The game loop only draws a frame after a
+// request, so a scene waiting on input costs nothing to display. Requests may
+// come from concurrent animation phases, so the flag is atomic
+//================================================================================
+class RedrawTracker
+{
+// Methods
+private:
+    RedrawTracker();
+    RedrawTracker(const RedrawTracker& copy);
+
+public:
+    ~RedrawTracker();
+
+    static RedrawTracker&   instance();
+    void                    request();
+    bool                    pending() const;
+    bool                    take();
+
+// Members
+private:
+    std::atomic<bool>       pending_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "Renderer.h"
+
+//----------------------------------------------------------------------------
+// - Renderer Constructor
+//----------------------------------------------------------------------------
+// * window : window drawn onto, whose GL context is handed over to the render
+//      thread
+//----------------------------------------------------------------------------
+Renderer::Renderer(sf::RenderWindow& window) :
+    window_(window),
+    back_(0),
+    pending_(false),
+    busy_(false),
+    closing_(false),
+    frames_(0)
+{
+    lists_[0] = new DrawList(window.getSize());
+    lists_[1] = new DrawList(window.getSize());
+
+    window_.setActive(false);
+    thread_ = std::thread(&Renderer::run, this);
+}
+
+//----------------------------------------------------------------------------
+// - Renderer Copy Constructor (private, empty)
+//----------------------------------------------------------------------------
+Renderer::Renderer(const Renderer& copy) :
+    window_(copy.window_)
+{}
+
+//----------------------------------------------------------------------------
+// - Renderer Destructor
+//----------------------------------------------------------------------------
+// Lets the render thread finish any submitted frame, then hands the window's
+// GL context back to the calling thread
+//----------------------------------------------------------------------------
+Renderer::~Renderer()
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        closing_ = true;
+    }
+
+    wake_.notify_one();
+    thread_.join();
+
+    window_.setActive(true);
+
+    delete lists_[0];
+    delete lists_[1];
+}
+
+//----------------------------------------------------------------------------
+// - Record Frame
+//----------------------------------------------------------------------------
+// Returns the emptied draw list to record the next frame into, which the
+// render thread leaves alone until it is submitted
+//----------------------------------------------------------------------------
+DrawList& Renderer::record()
+{
+    lists_[back_]->reset();
+
+    return *lists_[back_];
+}
+
+//----------------------------------------------------------------------------
+// - Submit Frame
+//----------------------------------------------------------------------------
+// Hands the recorded frame over to the render thread, once it has finished
+// drawing the previous one
+//----------------------------------------------------------------------------
+void Renderer::submit()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    sf::Clock clock;
+    done_.wait(lock, [this](){return !pending_ && !busy_;});
+    waiting_ += clock.getElapsedTime();
+
+    back_ = 1 - back_;
+    pending_ = true;
+    wake_.notify_one();
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Count
+//----------------------------------------------------------------------------
+// Returns the number of frames drawn onto the window so far
+//----------------------------------------------------------------------------
+unsigned long Renderer::frames() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return frames_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Rendering Time
+//----------------------------------------------------------------------------
+// Returns the time the render thread spent drawing and displaying frames
+//----------------------------------------------------------------------------
+sf::Time Renderer::rendering() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return rendering_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Waiting Time
+//----------------------------------------------------------------------------
+// Returns the time submitting frames spent waiting on the render thread
+//----------------------------------------------------------------------------
+sf::Time Renderer::waiting() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return waiting_;
+}
+
+//----------------------------------------------------------------------------
+// - Run Render Thread (private)
+//----------------------------------------------------------------------------
+// Draws each submitted frame until closing
+//----------------------------------------------------------------------------
+void Renderer::run()
+{
+    window_.setActive(true);
+
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while(true)
+    {
+        wake_.wait(lock, [this](){return pending_ || closing_;});
+
+        if(!pending_)
+        {
+            break;
+        }
+
+        pending_ = false;
+        busy_ = true;
+        const DrawList& front = *lists_[1 - back_];
+        lock.unlock();
+
+        sf::Clock clock;
+        window_.clear(sf::Color::Black);
+        front.play(window_);
+        window_.display();
+        sf::Time elapsed = clock.getElapsedTime();
+
+        lock.lock();
+        busy_ = false;
+        frames_++;
+        rendering_ += elapsed;
+        done_.notify_all();
+    }
+
+    window_.setActive(false);
+}
\ No newline at end of file
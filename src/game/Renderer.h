@@ -0,0 +1,56 @@
+#ifndef TACTICS_RENDERER_H
+#define TACTICS_RENDERER_H
+
+#include "DrawList.h"
+#include <SFML/Graphics.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//================================================================================
+// ** Renderer
+//================================================================================
+// Dedicated render thread drawing frames recorded by the game loop onto the
+// window, so the next update runs while the last frame is still being drawn.
+// Frames are recorded into one of two draw lists while the thread plays the
+// other: submitting a frame waits for the thread to finish the previous one,
+// then swaps them. The window's GL context belongs to the render thread for
+// as long as the renderer exists, but its events are still polled by the
+// thread which created it
+//================================================================================
+class Renderer
+{
+// Methods
+private:
+    Renderer(const Renderer& copy);
+
+public:
+    Renderer(sf::RenderWindow& window);
+    ~Renderer();
+
+    DrawList&                   record();
+    void                        submit();
+    unsigned long               frames() const;
+    sf::Time                    rendering() const;
+    sf::Time                    waiting() const;
+
+private:
+    void                        run();
+
+// Members
+    sf::RenderWindow&           window_;
+    DrawList*                   lists_[2];
+    int                         back_;
+    std::thread                 thread_;
+    mutable std::mutex          lock_;
+    std::condition_variable     wake_;
+    std::condition_variable     done_;
+    bool                        pending_;
+    bool                        busy_;
+    bool                        closing_;
+    unsigned long               frames_;
+    sf::Time                    rendering_;
+    sf::Time                    waiting_;
+};
+
+#endif
\ No newline at end of file
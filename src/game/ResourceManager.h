@@ -5,12 +5,13 @@
 #include <string>
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include "Simulation.h"
 
 //================================================================================
 // ** Resource Manager
 //================================================================================
 // Generalized container for loading resources in order to catalog them into a
-// single register
+// single register. Headless simulations register empty resources instead
 //================================================================================
 template <typename Type>
 class ResourceManager {
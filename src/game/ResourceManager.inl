@@ -13,7 +13,8 @@ ResourceManager<Type>::~ResourceManager() {
 // - Load Resource (Safe)
 //----------------------------------------------------------------------------
 // * filepath : path to the resource to be loaded and returned
-// Loads the resource if it is not already present
+// Loads the resource if it is not already present. Left empty when headless,
+// as loading graphics requires a display
 //----------------------------------------------------------------------------
 template <typename Type>
 const Type& ResourceManager<Type>::load(const std::string& filepath) {
@@ -23,7 +24,8 @@ const Type& ResourceManager<Type>::load(const std::string& filepath) {
 
 	if (record == files_.end()) {
 		resource = new Type;
-		resource->loadFromFile(filepath);
+		if (!Simulation::headless())
+			resource->loadFromFile(filepath);
 		files_[filepath] = resource;
 	}
 	else
@@ -2,8 +2,36 @@
 #include "../sprite/map/SpriteTile.h"
 #include "InputManager.h"
 #include "ActionScheduler.h"
+#include "Simulation.h"
+#include "DrawList.h"
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// - Mix Into Hash
+//----------------------------------------------------------------------------
+// * hash : running 64-bit FNV-1a hash
+// * value : value whose bytes are mixed in
+//----------------------------------------------------------------------------
+template <typename Type>
+static void mix(uint64_t& hash, const Type& value)
+{
+    unsigned char bytes[sizeof(Type)];
+    memcpy(bytes, &value, sizeof(Type));
+
+    for(int i = 0; i < sizeof(Type); i++)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+}
+
+// Graphics the scene draws, packed together into its texture atlas
+static const char* SCENE_GRAPHICS[] = {
+    "GrassTile_32x16.png", "DirtTile_32x16.png", "Assassin.png", "Paladin.png",
+    "AssassinPortrait_64x104.png", "PaladinPortrait_64x104.png", "Cursor_32x16.png",
+    "AreaSquare.png", "MenuFrame.png"
+};
 
 //----------------------------------------------------------------------------
 // - Scene Constructor
@@ -18,12 +46,14 @@ Scene::Scene(const sf::Vector2f& dimensions) :
     actionMenu_(0),
     mainMenu_(0),
     acting_(0),
+    turn_(0),
     cursor_(0),
     cursorSprite_(0),
     moveSelector_(0),
     targetSelector_(0),
     targetConfirmer_(0),
     highlightArea_(0),
+    dangerArea_(0),
     active_(false),
     closed_(false),
     moved_(false),
@@ -31,13 +61,15 @@ Scene::Scene(const sf::Vector2f& dimensions) :
     confirmedMove_(false),
     originalFacing_(0),
     textures_(0),
-    fonts_(0),
     grid_(0),
     gridLabels_(0)
 {
     view_.setCenter(0, 0);
     screen_.setCenter(0, 0);
-    spot_.create(2, 2);  
+    if(!Simulation::headless())
+    {
+        spot_.create(2, 2);
+    }
 
     setup();
 }
@@ -59,9 +91,11 @@ Scene::~Scene()
     if(targetSelector_)     delete targetSelector_;
     if(targetConfirmer_)    delete targetConfirmer_;
     if(highlightArea_)      delete highlightArea_;
+    if(dangerArea_)         delete dangerArea_;
     if(textures_)           delete textures_;    
-    if(fonts_)              delete fonts_;
     for(Actor* actor : actors_) delete actor;
+    for(Panorama* layer : backgrounds_) delete layer;
+    for(Panorama* layer : foregrounds_) delete layer;
 
     if(grid_)
     {
@@ -82,6 +116,7 @@ Scene::~Scene()
 void Scene::nextTurn()
 {
     Actor* actor = actors_[(acting_ = ((acting_ + 1) % actors_.size()))];
+    turn_++;
     originalPosition_ = actor->position();
     originalFacing_ = actor->facing();
     
@@ -149,6 +184,110 @@ void Scene::close()
     closed_ = true;
 }
 
+//----------------------------------------------------------------------------
+// - Still Staging
+//----------------------------------------------------------------------------
+// Stops every panorama from drifting, so that they no longer ask for redraws
+//----------------------------------------------------------------------------
+void Scene::stillStaging()
+{
+    for(Panorama* layer : backgrounds_) layer->setPanningRate(0);
+    for(Panorama* layer : foregrounds_) layer->setPanningRate(0);
+}
+
+//----------------------------------------------------------------------------
+// - Get Turn Count
+//----------------------------------------------------------------------------
+// Returns the number of turns started so far
+//----------------------------------------------------------------------------
+int Scene::turn() const
+{
+    return turn_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Turn Phase
+//----------------------------------------------------------------------------
+// Returns the stage of the turn, told by the control on top of the input stack.
+// Controls disabled while an actor walks or casts mark those stages
+//----------------------------------------------------------------------------
+Phase::Stage Scene::phase() const
+{
+    const InputHandler* top = InputManager::instance().getHandler();
+
+    if(top == 0)                    return Phase::Idle;
+    if(top == battleMenu_)          return Phase::BattleMenu;
+    if(top == actionMenu_)          return Phase::ActionMenu;
+    if(top == mainMenu_)            return Phase::MainMenu;
+    if(top == targetSelector_)      return Phase::SelectingTarget;
+    if(top == moveSelector_)        return top->active() ? Phase::SelectingDestination : Phase::Moving;
+    if(top == targetConfirmer_)     return top->active() ? Phase::ConfirmingTargets : Phase::Casting;
+
+    return Phase::Browsing;
+}
+
+//----------------------------------------------------------------------------
+// - Hash Scene State
+//----------------------------------------------------------------------------
+// Returns a hash of the game state: turn flow, actors, cursors and view. Floats
+// are hashed by their exact bits, so any divergence between two runs shows up.
+// Global frame counts are left out, so scenes run one after another in the
+// same process hash alike
+//----------------------------------------------------------------------------
+uint64_t Scene::hash() const
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    mix(hash, turn_);
+    mix(hash, acting_);
+    mix(hash, active_);
+    mix(hash, closed_);
+    mix(hash, moved_);
+    mix(hash, acted_);
+    mix(hash, confirmedMove_);
+
+    for(const Actor* actor : actors_)
+    {
+        mix(hash, actor->position());
+        mix(hash, actor->facing());
+        mix(hash, actor->walking());
+    }
+
+    const MobileObject* cursors[4] = {cursor_, moveSelector_, targetSelector_, targetConfirmer_};
+    for(const MobileObject* cursor : cursors)
+    {
+        mix(hash, cursor->position());
+    }
+
+    const InputHandler* handlers[7] = {cursor_, moveSelector_, targetSelector_, targetConfirmer_, mainMenu_, battleMenu_, actionMenu_};
+    const InputHandler* top = InputManager::instance().getHandler();
+    int handler = -1;
+    for(int h = 0; h < 7; h++)
+    {
+        if(handlers[h] == top)
+        {
+            handler = h;
+        }
+    }
+    mix(hash, handler);
+    mix(hash, view_.getCenter());
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------
+// - Compute Coverage
+//----------------------------------------------------------------------------
+// Returns the per-team reach and threat of every actor in the scene, computed
+// in parallel from the map as it stands
+//----------------------------------------------------------------------------
+const Coverage& Scene::computeCoverage()
+{
+    coverage_.compute(*map_, actors_);
+
+    return coverage_;
+}
+
 //----------------------------------------------------------------------------
 // - Setup Scene
 //----------------------------------------------------------------------------
@@ -157,9 +296,19 @@ void Scene::close()
 //----------------------------------------------------------------------------
 void Scene::setup()
 {    
-    // Initiate resource catalogs
-    textures_ = new TextureManager;
-    fonts_ = new FontManager;  
+    // Initiate the texture atlas, packing every graphic of the scene into it
+    // unless one was packed offline. Fonts are served by the glyph atlas
+    textures_ = new TextureAtlas;
+
+    if(!textures_->open("resources/graphics/atlas"))
+    {
+        for(const char* graphic : SCENE_GRAPHICS)
+        {
+            textures_->add(std::string("resources/graphics/") + graphic);
+        }
+
+        textures_->pack();
+    }
 
     setupMap();
     setupActors();
@@ -172,8 +321,8 @@ void Scene::setup()
     setupHUDs();
 
     // Cursor sprite shared by all battle scene cursors
-    const sf::Texture& texture = textures_->load("resources/graphics/Cursor_32x16.png");
-    cursorSprite_ = new sf::Sprite(texture);
+    const TextureRegion& texture = textures_->load("resources/graphics/Cursor_32x16.png");
+    cursorSprite_ = new sf::Sprite(*texture.getTexture(), texture.getRect());
     cursorSprite_->setOrigin(texture.getSize().x / 2, texture.getSize().y / 2);
 
     // Controls
@@ -194,8 +343,8 @@ void Scene::setupMap()
     // layer of 2-unit height dirt tiles
     map_ = new Map(15, 15);
 
-    const sf::Texture& grass_texture = textures_->load("resources/graphics/GrassTile_32x16.png");
-    const sf::Texture& dirt_texture = textures_->load("resources/graphics/DirtTile_32x16.png");
+    const TextureRegion& grass_texture = textures_->load("resources/graphics/GrassTile_32x16.png");
+    const TextureRegion& dirt_texture = textures_->load("resources/graphics/DirtTile_32x16.png");
 
     for(int x = 0; x < map_->width(); x++)
     {
@@ -238,6 +387,7 @@ void Scene::setupActors()
     actor->setPortrait(textures_->load("resources/graphics/PaladinPortrait_64x104.png"));
     actors_.push_back(actor);
     actor->setName("Paladin");
+    actor->setTeam(1);
     
     int x, y;
 
@@ -261,12 +411,40 @@ void Scene::setupActors()
 //----------------------------------------------------------------------------
 // - Setup Staging
 //----------------------------------------------------------------------------
-// Creates the background and foreground (LATER) for the scene
+// Creates the background and foreground layers for the scene, and the
+// debugging grid
 //----------------------------------------------------------------------------
 void Scene::setupStaging()
 {
+    // The 256 pixel cloud and fog images repeat at their own size on screen
+    sf::Vector2f tiled(ASPECT_RATIO.x / 256, ASPECT_RATIO.y / 256);
+
+    // Background: a still sky barely following the camera, clouds drifting
+    // across it a little closer
+    Panorama* sky = new Panorama(layers_.load("resources/graphics/CloudySky.jpg"), sf::Vector2f(1, ASPECT_RATIO.y / ASPECT_RATIO.x));
+    sky->setPanningRate(0);
+    sky->setParallax(sf::Vector2f(0.05, 0.05));
+    sky->setCamera(&view_);
+    backgrounds_.push_back(sky);
+
+    Panorama* clouds = new Panorama(layers_.load("resources/graphics/Clouds.png"), tiled);
+    clouds->setPanningRate(0.01);
+    clouds->setDirection(10);
+    clouds->setParallax(sf::Vector2f(0.2, 0.2));
+    clouds->setCamera(&view_);
+    backgrounds_.push_back(clouds);
+
+    // Foreground: faint fog drifting over the map, passing by faster than it
+    Panorama* fog = new Panorama(layers_.load("resources/graphics/Fog.png"), tiled);
+    fog->setPanningRate(0.02);
+    fog->setDirection(190);
+    fog->setParallax(sf::Vector2f(1.25, 1.25));
+    fog->setCamera(&view_);
+    fog->setColor(sf::Color(255, 255, 255, 96));
+    foregrounds_.push_back(fog);
+
     grid_ = new sf::RectangleShape[320];
-    gridLabels_ = new sf::Text[320];
+    gridLabels_ = new TextLabel[320];
 
     for(int x = 0; x < 20; x++)
     {
@@ -278,7 +456,7 @@ void Scene::setupStaging()
             
             std::stringstream ss;
             ss << "(" << (x - 10) << "," << (y - 8) << ")";
-            gridLabels_[x + y * 20] = sf::Text(ss.str(), fonts_->load("resources/fonts/Arial.ttf"), 8);
+            gridLabels_[x + y * 20] = TextLabel(ss.str(), 8);
             gridLabels_[x + y * 20].setColor(sf::Color::Red);
             gridLabels_[x + y * 20].setPosition((x - 10) * 32 + 4, (y - 8) * 32 + 4);
         }
@@ -481,8 +659,9 @@ void Scene::setupTargetConfirmer()
 // * actor : current acting player
 // Shows the main battle menu for this actor, populating the menu with the
 // appropriate options and placing it at the lower-right corner of the screen
+// once the view has scrolled to them
 //----------------------------------------------------------------------------
-void Scene::displayBattleMenu(Actor* actor)
+Script Scene::displayBattleMenu(Actor* actor)
 {
     // Reset all cursor positions to the current acting player
     cursor_->setPosition(actor->position());
@@ -503,11 +682,13 @@ void Scene::displayBattleMenu(Actor* actor)
     view_.scrollTo(IsometricObject::isoToGlobal(actor->position()), 0.5);
 
     // After scrolling, show the HUD for the actor and the battle menu
-    ActionScheduler::instance().schedule(Action([this, actor]()
+    if(view_.scrolling())
     {
-        actorHUD_->setActor(actor);
-        InputManager::instance().push(battleMenu_);        
-    }, 0.5 * FPS));
+        co_await view_.scrolled();
+    }
+
+    actorHUD_->setActor(actor);
+    InputManager::instance().push(battleMenu_);
 }
 
 //----------------------------------------------------------------------------
@@ -540,12 +721,33 @@ void Scene::displayActionMenu(Actor* actor)
 //----------------------------------------------------------------------------
 // * actor : current acting player
 // Displays an area depicting all positions where the user can move in blue,
-// as well as a cursor to select one of those positions
+// tinting red those another team could strike this turn, as well as a cursor
+// to select one of those positions
 //----------------------------------------------------------------------------
 void Scene::selectDestination(Actor* actor)
 {
-    // Highlight all possible movements
-    highlight(actor->reach(), sf::Color(120, 120, 255));
+    std::vector<sf::Vector2f> reach = actor->reach();
+    std::vector<sf::Vector2f> danger;
+    const Coverage& coverage = computeCoverage();
+
+    // Find the possible movements lying within any other team's threat
+    for(const sf::Vector2f& position : reach)
+    {
+        for(int team = 0; team < coverage.teams(); team++)
+        {
+            if(team != actor->getTeam() && coverage.threat(team).get(position.x, position.y))
+            {
+                danger.push_back(position);
+                break;
+            }
+        }
+    }
+
+    // Highlight all possible movements, then the danger zone over them
+    highlight(reach, sf::Color(120, 120, 255));
+
+    dangerArea_ = new SpriteArea(textures_->load("resources/graphics/AreaSquare.png"), danger, *map_, sf::Color(255, 120, 120, 128));
+    map_->addObject(dangerArea_);
 
     InputManager::instance().push(moveSelector_);
 }
@@ -661,12 +863,22 @@ void Scene::clearHighlight()
         delete highlightArea_;
         highlightArea_ = 0;
     }
+
+    if(dangerArea_ != 0)
+    {
+        delete dangerArea_;
+        dangerArea_ = 0;
+    }
 }
 
 //----------------------------------------------------------------------------
 // - Move Actor
 //----------------------------------------------------------------------------
-void Scene::move(Actor* actor, const sf::Vector3f& destination)
+// * actor : actor to move
+// * destination : map position the actor walks to; held by value, since the
+//      script outlives the caller
+//----------------------------------------------------------------------------
+Script Scene::move(Actor* actor, sf::Vector3f destination)
 {
     // Disable input during move
     InputManager::instance().getHandler()->setActive(false);
@@ -687,18 +899,17 @@ void Scene::move(Actor* actor, const sf::Vector3f& destination)
     map_->exit(originalPosition_.x, originalPosition_.y);
     map_->enter(actor, destination.x, destination.y);
 
-    // When the actor is finished moving, unfocus the view, remove the highlighting,
-    // return the actor to its default animation and display the main battle menu
-    Action action([this, actor, &destination]()
+    if(actor->walking())
     {
-        view_.stopFocusing();
-        clearHighlight();
-        actor->getSprite()->play("default", true);
-        displayBattleMenu(actor);
-    }, -1);
-    action.setTrigger([actor](){return !actor->walking();});
+        co_await actor->walked();
+    }
 
-    ActionScheduler::instance().schedule(action);
+    // When the actor is finished moving, unfocus the view, remove the highlighting,
+    // return the actor to its default animation and display the main battle menu
+    view_.stopFocusing();
+    clearHighlight();
+    actor->getSprite()->play("default", true);
+    displayBattleMenu(actor);
 }
 
 //----------------------------------------------------------------------------
@@ -723,9 +934,10 @@ void Scene::cancelMove()
 // - Cast Skill
 //----------------------------------------------------------------------------
 // * skill : skill being cast
-// * targets : list of all actors this skill will target
+// * targets : list of all actors this skill will target; held by value, since
+//      the script outlives the caller
 //----------------------------------------------------------------------------
-void Scene::cast(Skill* skill, const std::vector<Actor*>& targets)
+Script Scene::cast(Skill* skill, std::vector<Actor*> targets)
 {    
     // Block all input
     InputManager::instance().getHandler()->setActive(false);
@@ -748,80 +960,151 @@ void Scene::cast(Skill* skill, const std::vector<Actor*>& targets)
     
     acted_ = true;
 
-    // When the actor is finished casting this skill, display the battle menu
-    Action action([this, skill]()
-    {
-        // Remove any intermediate controllers (action menu)
-        InputManager::instance().popTo(cursor_);
-        displayBattleMenu(skill->caster());
-    }, -1);
-    action.setTrigger([skill](){return !skill->casting();});
-
     // Cast the skill!
     skill->use(targets);
 
-    ActionScheduler::instance().schedule(action);    
+    if(skill->casting())
+    {
+        co_await skill->castEnded();
+    }
+
+    // When the actor is finished casting this skill, display the battle menu,
+    // removing any intermediate controllers (action menu)
+    InputManager::instance().popTo(cursor_);
+    displayBattleMenu(skill->caster());
 }
 
 //----------------------------------------------------------------------------
 // - Draw Scene
 //----------------------------------------------------------------------------
 // Draws the scene onto a render target in the following order:
-// 1) Background (panorama)
+// 1) Background (panoramas)
 // 2) Map & Actors
-// 3) HUD & Menus
-// 4) Foreground (fogs, etc.)
+// 3) Foreground (fogs, etc.)
+// 4) HUD & Menus
 // 5) Tint/Flash Overlays
 //----------------------------------------------------------------------------
 void Scene::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if(active_ && !closed_)
     {        
-        // Map & Actors
-        target.setView(view_);
-        
-        if(map_)
-        {
-            target.draw(*map_, states);
-        }
+        drawBackground(target, states);
+        drawMap(target, states);
+        drawForeground(target, states);
+        drawHUDs(target, states);
+        drawMenus(target, states);
+        drawOverlays(target, states);
+    }
+}
 
-        // HUD & Menus
-        target.setView(screen_);
+//----------------------------------------------------------------------------
+// - Draw Background (protected)
+//----------------------------------------------------------------------------
+// * target : render target the scene is drawn onto
+// * states : render states the scene is drawn with
+// Each drawing phase may be drawn on its own, as when timing them, so each
+// sets up the view it draws through. Layers cover the screen, following the
+// scene's view by their own parallax
+//----------------------------------------------------------------------------
+void Scene::drawBackground(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.setView(screen_);
 
-        if(actorHUD_)
-        {
-            target.draw(*actorHUD_, states);
-        }
+    for(const Panorama* layer : backgrounds_)
+    {
+        target.draw(*layer, states);
+    }
+}
 
-        if(targetHUD_)
-        {
-            target.draw(*targetHUD_, states);
-        }
+//----------------------------------------------------------------------------
+// - Draw Map & Actors (protected)
+//----------------------------------------------------------------------------
+void Scene::drawMap(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.setView(view_);
+    
+    if(map_)
+    {
+        target.draw(*map_, states);
+    }
+}
 
-        if(mainMenu_)
-        {
-            target.draw(*mainMenu_, states);
-        }
+//----------------------------------------------------------------------------
+// - Draw Foreground (protected)
+//----------------------------------------------------------------------------
+void Scene::drawForeground(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.setView(screen_);
 
-        if(battleMenu_)
-        {
-            target.draw(*battleMenu_, states);
-        }
+    for(const Panorama* layer : foregrounds_)
+    {
+        target.draw(*layer, states);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Draw HUDs (protected)
+//----------------------------------------------------------------------------
+void Scene::drawHUDs(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.setView(screen_);
+
+    if(actorHUD_)
+    {
+        target.draw(*actorHUD_, states);
+    }
+
+    if(targetHUD_)
+    {
+        target.draw(*targetHUD_, states);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Draw Menus (protected)
+//----------------------------------------------------------------------------
+void Scene::drawMenus(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.setView(screen_);
 
-        if(actionMenu_)
+    if(mainMenu_)
+    {
+        target.draw(*mainMenu_, states);
+    }
+
+    if(battleMenu_)
+    {
+        target.draw(*battleMenu_, states);
+    }
+
+    if(actionMenu_)
+    {
+        target.draw(*actionMenu_, states);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Draw Overlays (protected)
+//----------------------------------------------------------------------------
+// Draws the view's tint and flash overlays, then the debugging grid. Its
+// points and labels never overlap, so all points are drawn before all labels,
+// letting draw lists batch each
+//----------------------------------------------------------------------------
+void Scene::drawOverlays(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.setView(screen_);
+
+    view_.drawOverlays(target);
+
+    if(grid_){
+        for(int i = 0; i < 320; i++)
         {
-            target.draw(*actionMenu_, states);
+            DrawList::submit(target, grid_[i]);
         }
 
-        // Tint/Flash Overlays
-        view_.drawOverlays(target);
-
-        if(grid_){
-            for(int i = 0; i < 320; i++)
-            {
-                target.draw(grid_[i]);
-                target.draw(gridLabels_[i]);
-            }
+        for(int i = 0; i < 320; i++)
+        {
+            target.draw(gridLabels_[i]);
         }
     }
 }
@@ -10,8 +10,18 @@
 #include "../sprite/SpriteActorHUD.h"
 #include "../sprite/SpriteArea.h"
 #include "../settings.h"
+#include "../sprite/TextLabel.h"
+#include "TextureAtlas.h"
 #include "ResourceManager.h"
+#include "Coverage.h"
+#include "Script.h"
 #include <vector>
+#include <stdint.h>
+
+namespace Phase{
+    // Stages of a turn, as seen from the controls
+    enum Stage {Idle, Browsing, BattleMenu, ActionMenu, SelectingDestination, Moving, SelectingTarget, ConfirmingTargets, Casting, MainMenu};
+}
 
 //================================================================================
 // ** Scene
@@ -32,6 +42,11 @@ public:
     virtual void        start();
     bool                closed() const;
     void                close();
+    void                stillStaging();
+    int                 turn() const;
+    Phase::Stage        phase() const;
+    uint64_t            hash() const;
+    const Coverage&     computeCoverage();
 
 protected:
 // Methods - Setup 
@@ -53,7 +68,7 @@ protected:
     void                setupTargetConfirmer();
 
 // Methods - Menu/Control Displays
-    void                displayBattleMenu(Actor* actor);
+    Script              displayBattleMenu(Actor* actor);
     void                displayActionMenu(Actor* actor);
     void                selectDestination(Actor* actor);
     void                selectTargets(Skill* skill);
@@ -62,16 +77,24 @@ protected:
 // Methods - Object Controls
     void                highlight(const std::vector<sf::Vector2f>& area, const sf::Color& color);
     void                clearHighlight();
-    void                move(Actor* actor, const sf::Vector3f& destination);
+    Script              move(Actor* actor, sf::Vector3f destination);
     void                cancelMove();
-    void                cast(Skill* skill, const std::vector<Actor*>& targets);
+    Script              cast(Skill* skill, std::vector<Actor*> targets);
     
     virtual void        draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                drawBackground(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                drawMap(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                drawForeground(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                drawHUDs(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                drawMenus(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                drawOverlays(sf::RenderTarget& target, sf::RenderStates states) const;
     
 // Members - Staging
     std::vector<Actor*> actors_;
     Map*                map_;
     ViewEx              view_;
+    std::vector<Panorama*> backgrounds_;
+    std::vector<Panorama*> foregrounds_;
     
 // Members - HUD & Menus
     sf::View            screen_;
@@ -83,6 +106,7 @@ protected:
     
 // Members - Control Flow
     int                 acting_;
+    int                 turn_;
     bool                active_;
     bool                closed_;
     sf::Sprite*         cursorSprite_;
@@ -91,6 +115,7 @@ protected:
     Cursor*             targetSelector_;
     TargetConfirmer*    targetConfirmer_;
     SpriteArea*         highlightArea_;
+    SpriteArea*         dangerArea_;
 
 // Members - Actor Control
     bool                moved_;
@@ -98,14 +123,15 @@ protected:
     bool                confirmedMove_;
     int                 originalFacing_;
     sf::Vector3f        originalPosition_;
+    Coverage            coverage_;
 
 // Members - Resources
-    TextureManager*     textures_;
-    FontManager*        fonts_;
+    TextureAtlas*       textures_;
+    TextureManager      layers_;
 
     sf::Texture         spot_;
     sf::RectangleShape* grid_;
-    sf::Text*           gridLabels_;
+    TextLabel*          gridLabels_;
 };
 
 #endif
\ No newline at end of file
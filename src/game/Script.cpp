@@ -0,0 +1,252 @@
+#include "Script.h"
+#include "ActionScheduler.h"
+#include "Signal.h"
+#include <exception>
+#include <new>
+
+// Script frame pool: blocks are recycled by size class, in steps of
+// POOL_GRANULE bytes. Larger frames are left to the heap
+static const int POOL_GRANULE = 64;
+static const int POOL_CLASSES = 32;
+
+// Free block list node, stored in the block itself
+struct PoolBlock
+{
+    PoolBlock*  next;
+};
+
+static PoolBlock*   poolFree[POOL_CLASSES] = {0};
+static int          poolAllocated = 0;
+
+// Number of scripts suspended, owned by their resuming actions
+static int          scriptsSuspended = 0;
+
+//----------------------------------------------------------------------------
+// - Get Script Object (Promise)
+//----------------------------------------------------------------------------
+Script Script::promise_type::get_return_object()
+{
+    return Script();
+}
+
+//----------------------------------------------------------------------------
+// - Initial Suspension (Promise)
+//----------------------------------------------------------------------------
+// Scripts run as soon as they are called
+//----------------------------------------------------------------------------
+std::suspend_never Script::promise_type::initial_suspend()
+{
+    return std::suspend_never();
+}
+
+//----------------------------------------------------------------------------
+// - Final Suspension (Promise)
+//----------------------------------------------------------------------------
+// Scripts destroy themselves as soon as they finish
+//----------------------------------------------------------------------------
+std::suspend_never Script::promise_type::final_suspend() noexcept
+{
+    return std::suspend_never();
+}
+
+//----------------------------------------------------------------------------
+// - Return (Promise)
+//----------------------------------------------------------------------------
+void Script::promise_type::return_void()
+{}
+
+//----------------------------------------------------------------------------
+// - Unhandled Exception (Promise)
+//----------------------------------------------------------------------------
+void Script::promise_type::unhandled_exception()
+{
+    std::terminate();
+}
+
+//----------------------------------------------------------------------------
+// - Allocate Script Frame (Promise)
+//----------------------------------------------------------------------------
+// * size : size of the coroutine frame in bytes
+// Reuses a free block of the frame's size class if there is one
+//----------------------------------------------------------------------------
+void* Script::promise_type::operator new(std::size_t size)
+{
+    int sizeClass = (size + POOL_GRANULE - 1) / POOL_GRANULE - 1;
+
+    if(sizeClass >= POOL_CLASSES)
+    {
+        return ::operator new(size);
+    }
+    else if(poolFree[sizeClass])
+    {
+        PoolBlock* block = poolFree[sizeClass];
+        poolFree[sizeClass] = block->next;
+        return block;
+    }
+
+    poolAllocated++;
+    return ::operator new((sizeClass + 1) * POOL_GRANULE);
+}
+
+//----------------------------------------------------------------------------
+// - Release Script Frame (Promise)
+//----------------------------------------------------------------------------
+// * frame : coroutine frame being destroyed
+// * size : size of the coroutine frame in bytes
+// Returns the frame's block to the free list of its size class
+//----------------------------------------------------------------------------
+void Script::promise_type::operator delete(void* frame, std::size_t size)
+{
+    int sizeClass = (size + POOL_GRANULE - 1) / POOL_GRANULE - 1;
+
+    if(sizeClass >= POOL_CLASSES)
+    {
+        ::operator delete(frame);
+        return;
+    }
+
+    PoolBlock* block = static_cast<PoolBlock*>(frame);
+    block->next = poolFree[sizeClass];
+    poolFree[sizeClass] = block;
+}
+
+//----------------------------------------------------------------------------
+// - Resumer Constructor (Resumer)
+//----------------------------------------------------------------------------
+// * script : suspended script, owned until resumed
+//----------------------------------------------------------------------------
+Script::Resumer::Resumer(std::coroutine_handle<> script) :
+    script(script)
+{
+    scriptsSuspended++;
+}
+
+//----------------------------------------------------------------------------
+// - Resumer Move Constructor (Resumer)
+//----------------------------------------------------------------------------
+// * other : resumer whose script is taken over, leaving it empty
+//----------------------------------------------------------------------------
+Script::Resumer::Resumer(Resumer&& other) :
+    script(other.script)
+{
+    other.script = nullptr;
+}
+
+//----------------------------------------------------------------------------
+// - Resumer Destructor (Resumer)
+//----------------------------------------------------------------------------
+// A script still owned was never resumed, and is destroyed where it waits
+//----------------------------------------------------------------------------
+Script::Resumer::~Resumer()
+{
+    if(script)
+    {
+        scriptsSuspended--;
+        script.destroy();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Resume Script (Resumer)
+//----------------------------------------------------------------------------
+// Gives up ownership first, since the script may finish and destroy itself
+//----------------------------------------------------------------------------
+void Script::Resumer::operator()()
+{
+    std::coroutine_handle<> resumed = script;
+
+    script = nullptr;
+    scriptsSuspended--;
+    resumed.resume();
+}
+
+//----------------------------------------------------------------------------
+// - Frames Ready? (Frames)
+//----------------------------------------------------------------------------
+// Waiting on no frames at all does not suspend
+//----------------------------------------------------------------------------
+bool Script::Frames::await_ready() const
+{
+    return frames <= 0;
+}
+
+//----------------------------------------------------------------------------
+// - Suspend for Frames (Frames)
+//----------------------------------------------------------------------------
+// * script : suspended script, resumed once the frames have passed
+//----------------------------------------------------------------------------
+void Script::Frames::await_suspend(std::coroutine_handle<> script) const
+{
+    ActionScheduler::instance().schedule(Action(Resumer(script), frames - 1));
+}
+
+//----------------------------------------------------------------------------
+// - Resume After Frames (Frames)
+//----------------------------------------------------------------------------
+void Script::Frames::await_resume() const
+{}
+
+//----------------------------------------------------------------------------
+// - Event Ready? (Event)
+//----------------------------------------------------------------------------
+bool Script::Event::await_ready() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------
+// - Suspend for Event (Event)
+//----------------------------------------------------------------------------
+// * script : suspended script, resumed on the step after the signal is
+//      emitted
+//----------------------------------------------------------------------------
+void Script::Event::await_suspend(std::coroutine_handle<> script) const
+{
+    ActionScheduler::instance().schedule(Action(Resumer(script), 0), signal);
+}
+
+//----------------------------------------------------------------------------
+// - Resume After Event (Event)
+//----------------------------------------------------------------------------
+void Script::Event::await_resume() const
+{}
+
+//----------------------------------------------------------------------------
+// - Get Number of Pooled Frame Blocks
+//----------------------------------------------------------------------------
+// Returns the number of blocks the frame pool has taken from the heap
+//----------------------------------------------------------------------------
+int Script::allocated()
+{
+    return poolAllocated;
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Suspended Scripts
+//----------------------------------------------------------------------------
+// Returns the number of scripts waiting to be resumed
+//----------------------------------------------------------------------------
+int Script::suspended()
+{
+    return scriptsSuspended;
+}
+
+//----------------------------------------------------------------------------
+// - Await Frames
+//----------------------------------------------------------------------------
+// * count : number of frames of the action scheduler to wait for
+//----------------------------------------------------------------------------
+Script::Frames frames(int count)
+{
+    return Script::Frames{count};
+}
+
+//----------------------------------------------------------------------------
+// - Await Signal
+//----------------------------------------------------------------------------
+// * signal : signal to wait for the next emission of
+//----------------------------------------------------------------------------
+Script::Event operator co_await(Signal& signal)
+{
+    return Script::Event{signal};
+}
\ No newline at end of file
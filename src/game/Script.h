@@ -0,0 +1,77 @@
+#ifndef TACTICS_SCRIPT_H
+#define TACTICS_SCRIPT_H
+
+#include <coroutine>
+#include <cstddef>
+
+class Signal;
+
+//================================================================================
+// ** Script
+//================================================================================
+// Coroutine task for sequencing game events over relative time. A script runs
+// as soon as it is called, until it awaits a number of frames or a signal;
+// it is then resumed by the action scheduler once the wait is over, costing
+// nothing in the meantime. Scripts own themselves and are destroyed when they
+// finish; a suspended script is owned by the action resuming it instead, and
+// destroyed along with it if that action is cancelled or cleared unexecuted.
+// A script awaiting a signal that is never emitted lives until its action is
+// cleared. Their frames come from a pool of recycled blocks, so running a
+// script does not allocate once the pool is warm
+//================================================================================
+class Script
+{
+public:
+    // Coroutine Promise Sub-structure
+    struct promise_type
+    {
+        Script                  get_return_object();
+        std::suspend_never      initial_suspend();
+        std::suspend_never      final_suspend() noexcept;
+        void                    return_void();
+        void                    unhandled_exception();
+
+        static void*            operator new(std::size_t size);
+        static void             operator delete(void* frame, std::size_t size);
+    };
+
+    // Suspended Script Owner Sub-structure
+    struct Resumer
+    {
+        Resumer(std::coroutine_handle<> script);
+        Resumer(Resumer&& other);
+        ~Resumer();
+        void                    operator()();
+
+        std::coroutine_handle<> script;
+    };
+
+    // Frame Delay Awaitable Sub-structure
+    struct Frames
+    {
+        bool                    await_ready() const;
+        void                    await_suspend(std::coroutine_handle<> script) const;
+        void                    await_resume() const;
+
+        int                     frames;
+    };
+
+    // Signal Awaitable Sub-structure
+    struct Event
+    {
+        bool                    await_ready() const;
+        void                    await_suspend(std::coroutine_handle<> script) const;
+        void                    await_resume() const;
+
+        Signal&                 signal;
+    };
+
+// Methods
+    static int                  allocated();
+    static int                  suspended();
+};
+
+Script::Frames  frames(int count);
+Script::Event   operator co_await(Signal& signal);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "Signal.h"
+#include "Animations.h"
+
+//----------------------------------------------------------------------------
+// - Signal Constructor
+//----------------------------------------------------------------------------
+Signal::Signal()
+{}
+
+//----------------------------------------------------------------------------
+// - Signal Destructor
+//----------------------------------------------------------------------------
+Signal::~Signal()
+{}
+
+//----------------------------------------------------------------------------
+// - Connect Slot
+//----------------------------------------------------------------------------
+// * slot : callable run once, on the next emission
+//----------------------------------------------------------------------------
+void Signal::connect(Slot&& slot)
+{
+    slots_.push_back(std::move(slot));
+}
+
+//----------------------------------------------------------------------------
+// - Any Slots Connected?
+//----------------------------------------------------------------------------
+bool Signal::connected() const
+{
+    return !slots_.empty();
+}
+
+//----------------------------------------------------------------------------
+// - Emit Signal
+//----------------------------------------------------------------------------
+// Calls and disconnects every slot, in the order they were connected. Slots
+// connected while emitting wait for the next emission
+//----------------------------------------------------------------------------
+void Signal::emit()
+{
+    if(Animations::instance().concurrent())
+    {
+        Animations::instance().defer(this);
+        return;
+    }
+
+    int count = slots_.size();
+
+    for(int i = 0; i < count; i++)
+    {
+        // Moved out, since the slot may connect more and grow the list
+        Slot slot(std::move(slots_[i]));
+        slot();
+    }
+
+    slots_.erase(slots_.begin(), slots_.begin() + count);
+}
+
+//----------------------------------------------------------------------------
+// - Clear Slots
+//----------------------------------------------------------------------------
+// Disconnects every slot without calling them
+//----------------------------------------------------------------------------
+void Signal::clear()
+{
+    slots_.clear();
+}
\ No newline at end of file
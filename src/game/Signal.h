@@ -0,0 +1,39 @@
+#ifndef TACTICS_SIGNAL_H
+#define TACTICS_SIGNAL_H
+
+#include "InlineFunction.h"
+#include <vector>
+
+// Bytes available to a signal's slots for their captures
+static const int SIGNAL_CAPACITY = 32;
+
+//================================================================================
+// ** Signal
+//================================================================================
+// Lightweight one-shot event an object emits when something happens to it,
+// such as arriving at a destination. Each connected slot is called on the next
+// emission only, then dropped, so waiting on an event costs nothing until it
+// fires. Emissions from a concurrent animation phase are deferred until the
+// phase is over. Slots are stored inline and the slot list keeps its capacity,
+// so connecting and emitting do not allocate once warmed up
+//================================================================================
+class Signal
+{
+// Methods
+public:
+    typedef InlineFunction<void(), SIGNAL_CAPACITY> Slot;
+
+    Signal();
+    ~Signal();
+
+    void                                connect(Slot&& slot);
+    bool                                connected() const;
+    void                                emit();
+    void                                clear();
+
+// Members
+private:
+    std::vector<Slot>                   slots_;
+};
+
+#endif
\ No newline at end of file
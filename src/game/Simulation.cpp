@@ -0,0 +1,126 @@
+#include "Simulation.h"
+#include "Animations.h"
+#include "Scene.h"
+#include "../settings.h"
+#include <algorithm>
+#include <cstdlib>
+
+bool Simulation::headless_ = false;
+
+//----------------------------------------------------------------------------
+// - Simulation Constructor
+//----------------------------------------------------------------------------
+// * seed : seed for the game's random numbers
+// * headless : whether the game runs without any display
+// Animation clocks are reset, so that a simulation plays out the same whether
+// or not another ran before it in the same process
+//----------------------------------------------------------------------------
+Simulation::Simulation(unsigned seed, bool headless) :
+    wasHeadless_(headless_),
+    seed_(seed),
+    frames_(0),
+    accumulated_(0)
+{
+    headless_ = headless;
+    srand(seed);
+    Animations::instance().resetClocks();
+}
+
+//----------------------------------------------------------------------------
+// - Simulation Copy Constructor (private, empty)
+//----------------------------------------------------------------------------
+Simulation::Simulation(const Simulation& copy)
+{}
+
+//----------------------------------------------------------------------------
+// - Simulation Destructor
+//----------------------------------------------------------------------------
+Simulation::~Simulation()
+{
+    headless_ = wasHeadless_;
+}
+
+//----------------------------------------------------------------------------
+// - Running Headless?
+//----------------------------------------------------------------------------
+// Returns whether a headless simulation is running, in which case nothing may
+// load or lay out graphics
+//----------------------------------------------------------------------------
+bool Simulation::headless()
+{
+    return headless_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Seed
+//----------------------------------------------------------------------------
+unsigned Simulation::seed() const
+{
+    return seed_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Count
+//----------------------------------------------------------------------------
+// Returns the number of frames stepped so far
+//----------------------------------------------------------------------------
+unsigned long Simulation::frames() const
+{
+    return frames_;
+}
+
+//----------------------------------------------------------------------------
+// - Step Frame
+//----------------------------------------------------------------------------
+// Advances all animations by exactly one frame
+//----------------------------------------------------------------------------
+void Simulation::step()
+{
+    Animations::instance().update(1 / FPS);
+    frames_++;
+}
+
+//----------------------------------------------------------------------------
+// - Advance by Elapsed Time
+//----------------------------------------------------------------------------
+// * elapsed : wall-clock seconds since the last advance
+// Steps as many whole frames as the elapsed time adds up to, carrying the
+// remainder over, so that a game paced by the wall clock steps the same
+// fixed frames as a replay of it. Catch-up is bounded as in the animations
+// update, the excess being dropped. Returns the number of frames stepped
+//----------------------------------------------------------------------------
+unsigned long Simulation::advance(float elapsed)
+{
+    accumulated_ += std::min(elapsed, MAX_ELAPSED);
+
+    int steps = accumulated_ * FPS;
+    accumulated_ -= steps / FPS;
+
+    for(int s = 0; s < std::min(steps, MAX_STEPS_PER_FRAME); s++)
+    {
+        step();
+    }
+
+    return std::min(steps, MAX_STEPS_PER_FRAME);
+}
+
+//----------------------------------------------------------------------------
+// - Run Scene
+//----------------------------------------------------------------------------
+// * scene : scene being simulated, started beforehand
+// * turns : turn count at which to stop
+// * frames : most frames to step before stopping
+// Steps until the scene reaches the given turn, closes, or the frames run out,
+// returning the number of frames stepped
+//----------------------------------------------------------------------------
+unsigned long Simulation::run(const Scene& scene, int turns, unsigned long frames)
+{
+    unsigned long start = frames_;
+
+    while(scene.turn() < turns && !scene.closed() && frames_ - start < frames)
+    {
+        step();
+    }
+
+    return frames_ - start;
+}
\ No newline at end of file
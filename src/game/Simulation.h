@@ -0,0 +1,44 @@
+#ifndef TACTICS_SIMULATION_H
+#define TACTICS_SIMULATION_H
+
+class Scene;
+
+//================================================================================
+// ** Simulation
+//================================================================================
+// Fixed-timestep driver advancing the game one frame of 1 / FPS seconds per
+// step, independent of wall-clock time, as fast as the logic allows. Seeds the
+// game's random numbers on construction, so it must exist before the scene it
+// drives is built. A windowed game may instead feed it wall-clock time, which
+// is stepped off in whole frames. A headless simulation never opens a
+// display: resources are left unloaded and text is never laid out, and
+// nothing is drawn. Given the same seed and the same input on the same
+// frames, runs are identical frame for frame
+//================================================================================
+class Simulation
+{
+// Methods
+private:
+    Simulation(const Simulation& copy);
+
+public:
+    Simulation(unsigned seed, bool headless = true);
+    ~Simulation();
+
+    static bool         headless();
+    unsigned            seed() const;
+    unsigned long       frames() const;
+    void                step();
+    unsigned long       advance(float elapsed);
+    unsigned long       run(const Scene& scene, int turns, unsigned long frames);
+
+// Members
+private:
+    static bool         headless_;
+    bool                wasHeadless_;
+    unsigned            seed_;
+    unsigned long       frames_;
+    float               accumulated_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,320 @@
+#include "TextureAtlas.h"
+#include "Simulation.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+// - Texture Atlas Constructor
+//----------------------------------------------------------------------------
+// * size : width and height of a page in pixels, capped by the largest
+//      texture the graphics card supports
+// * padding : empty pixels around each packed image
+//----------------------------------------------------------------------------
+TextureAtlas::TextureAtlas(unsigned size, unsigned padding) :
+    size_(size),
+    padding_(padding)
+{}
+
+//----------------------------------------------------------------------------
+// - Texture Atlas Destructor
+//----------------------------------------------------------------------------
+TextureAtlas::~TextureAtlas()
+{
+    for(sf::Texture* page : pages_)
+    {
+        delete page;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Add Image
+//----------------------------------------------------------------------------
+// * filepath : path to the image to pack into the atlas on the next pack
+// Returns false if the image could not be loaded. Headless simulations add an
+// empty image, as loading graphics requires a display
+//----------------------------------------------------------------------------
+bool TextureAtlas::add(const std::string& filepath)
+{
+    if(contains(filepath))
+    {
+        return true;
+    }
+
+    for(const Pending& pending : pending_)
+    {
+        if(pending.filepath == filepath)
+        {
+            return true;
+        }
+    }
+
+    pending_.push_back(Pending());
+    pending_.back().filepath = filepath;
+
+    if(!Simulation::headless() && !pending_.back().image.loadFromFile(filepath))
+    {
+        pending_.pop_back();
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// - Pack Images
+//----------------------------------------------------------------------------
+// Packs all added images onto new pages in shelves, tallest first, each
+// shelf as tall as its first image. Images too large for a page get a page
+// of their own. Returns the number of pages created
+//----------------------------------------------------------------------------
+int TextureAtlas::pack()
+{
+    std::sort(pending_.begin(), pending_.end(), [](const Pending& a, const Pending& b){
+        return a.image.getSize().y != b.image.getSize().y ? a.image.getSize().y > b.image.getSize().y : a.image.getSize().x > b.image.getSize().x;
+    });
+
+    int created = pages_.size();
+    sf::Texture* texture = 0;
+    sf::Image page;
+    unsigned limit = 0, x = 0, y = 0, shelf = 0, width = 0, height = 0;
+
+    for(const Pending& pending : pending_)
+    {
+        sf::Vector2u size = pending.image.getSize();
+
+        // Empty images, as in headless simulations, have nothing to pack
+        if(size.x == 0 || size.y == 0)
+        {
+            regions_[pending.filepath] = TextureRegion(empty_);
+            continue;
+        }
+
+        if(limit == 0)
+        {
+            limit = std::min(size_, sf::Texture::getMaximumSize());
+        }
+
+        unsigned w = size.x + padding_ * 2, h = size.y + padding_ * 2;
+
+        if(w > limit || h > limit)
+        {
+            sf::Texture* own = addPage();
+            own->loadFromImage(pending.image);
+            regions_[pending.filepath] = TextureRegion(*own);
+            continue;
+        }
+
+        // Next shelf, or next page once out of shelves
+        if(texture && x + w > limit)
+        {
+            x = 0;
+            y += shelf;
+            shelf = 0;
+        }
+
+        if(texture && y + h > limit)
+        {
+            texture->loadFromImage(page, sf::IntRect(0, 0, width, height));
+            texture = 0;
+        }
+
+        if(!texture)
+        {
+            texture = addPage();
+            page.create(limit, limit, sf::Color::Transparent);
+            x = y = shelf = width = height = 0;
+        }
+
+        blit(page, pending.image, x + padding_, y + padding_);
+        regions_[pending.filepath] = TextureRegion(*texture, sf::IntRect(x + padding_, y + padding_, size.x, size.y));
+
+        x += w;
+        shelf = std::max(shelf, h);
+        width = std::max(width, x);
+        height = std::max(height, y + shelf);
+    }
+
+    if(texture)
+    {
+        texture->loadFromImage(page, sf::IntRect(0, 0, width, height));
+    }
+
+    pending_.clear();
+
+    return pages_.size() - created;
+}
+
+//----------------------------------------------------------------------------
+// - Load Region (Safe)
+//----------------------------------------------------------------------------
+// * filepath : path to the image whose packed region is returned
+// Packs the image onto a page of its own if it was not already packed
+//----------------------------------------------------------------------------
+const TextureRegion& TextureAtlas::load(const std::string& filepath)
+{
+    auto record = regions_.find(filepath);
+
+    if(record == regions_.end())
+    {
+        add(filepath);
+        pack();
+        record = regions_.find(filepath);
+
+        if(record == regions_.end())
+        {
+            record = regions_.insert(std::make_pair(filepath, TextureRegion(empty_))).first;
+        }
+    }
+
+    return record->second;
+}
+
+//----------------------------------------------------------------------------
+// - Contains Image?
+//----------------------------------------------------------------------------
+// * filepath : path to the image, which must have been packed
+//----------------------------------------------------------------------------
+bool TextureAtlas::contains(const std::string& filepath) const
+{
+    return regions_.find(filepath) != regions_.end();
+}
+
+//----------------------------------------------------------------------------
+// - Get Page Count
+//----------------------------------------------------------------------------
+int TextureAtlas::pages() const
+{
+    return pages_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Get Page Texture
+//----------------------------------------------------------------------------
+// * index : page number within [0, pages)
+//----------------------------------------------------------------------------
+const sf::Texture& TextureAtlas::page(int index) const
+{
+    return *pages_[index];
+}
+
+//----------------------------------------------------------------------------
+// - Save Atlas
+//----------------------------------------------------------------------------
+// * prefix : path prefix of the saved files
+// Writes each page as <prefix>_<page>.png, and the regions to <prefix>.atlas
+// as lines of "filepath page left top width height"
+//----------------------------------------------------------------------------
+bool TextureAtlas::save(const std::string& prefix) const
+{
+    std::ofstream file(prefix + ".atlas");
+
+    if(!file)
+    {
+        return false;
+    }
+
+    file << pages_.size() << "\n";
+
+    for(int i = 0; i < pages_.size(); i++)
+    {
+        std::stringstream path;
+        path << prefix << "_" << i << ".png";
+
+        if(!pages_[i]->copyToImage().saveToFile(path.str()))
+        {
+            return false;
+        }
+    }
+
+    for(auto record : regions_)
+    {
+        int index = std::find(pages_.begin(), pages_.end(), record.second.getTexture()) - pages_.begin();
+        const sf::IntRect& rect = record.second.getRect();
+
+        if(index < pages_.size())
+        {
+            file << record.first << " " << index << " " << rect.left << " " << rect.top << " " << rect.width << " " << rect.height << "\n";
+        }
+    }
+
+    return bool(file);
+}
+
+//----------------------------------------------------------------------------
+// - Open Atlas
+//----------------------------------------------------------------------------
+// * prefix : path prefix of files written by save
+// Adds the saved pages and their regions. Headless simulations open nothing
+//----------------------------------------------------------------------------
+bool TextureAtlas::open(const std::string& prefix)
+{
+    std::ifstream file(prefix + ".atlas");
+    int count = 0;
+
+    if(Simulation::headless() || !file || !(file >> count))
+    {
+        return false;
+    }
+
+    int first = pages_.size();
+
+    for(int i = 0; i < count; i++)
+    {
+        std::stringstream path;
+        path << prefix << "_" << i << ".png";
+
+        if(!addPage()->loadFromFile(path.str()))
+        {
+            return false;
+        }
+    }
+
+    std::string filepath;
+    int index;
+    sf::IntRect rect;
+
+    while(file >> filepath >> index >> rect.left >> rect.top >> rect.width >> rect.height)
+    {
+        if(0 <= index && index < count)
+        {
+            regions_[filepath] = TextureRegion(*pages_[first + index], rect);
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// - Add Page (protected)
+//----------------------------------------------------------------------------
+sf::Texture* TextureAtlas::addPage()
+{
+    pages_.push_back(new sf::Texture);
+
+    return pages_.back();
+}
+
+//----------------------------------------------------------------------------
+// - Blit Image (protected)
+//----------------------------------------------------------------------------
+// * page : page image being packed
+// * image : image to copy onto the page
+// * x, y : top left corner of the image on the page
+// Copies the image, then its outermost rows and columns once more into the
+// padding around it
+//----------------------------------------------------------------------------
+void TextureAtlas::blit(sf::Image& page, const sf::Image& image, unsigned x, unsigned y) const
+{
+    int w = image.getSize().x, h = image.getSize().y;
+
+    page.copy(image, x, y);
+
+    if(padding_ > 0)
+    {
+        page.copy(image, x - 1, y, sf::IntRect(0, 0, 1, h));
+        page.copy(image, x + w, y, sf::IntRect(w - 1, 0, 1, h));
+        page.copy(image, x, y - 1, sf::IntRect(0, 0, w, 1));
+        page.copy(image, x, y + h, sf::IntRect(0, h - 1, w, 1));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef TACTICS_TEXTURE_ATLAS_H
+#define TACTICS_TEXTURE_ATLAS_H
+
+#include "../sprite/TextureRegion.h"
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+//================================================================================
+// ** Texture Atlas
+//================================================================================
+// Packs many images into a few large page textures, handing out regions of
+// them in place of separate textures. Sprites sharing a page draw without
+// switching textures, whatever their order. Images are added up front, then
+// shelf-packed together (tallest first) with their edges extruded into the
+// padding so scaled sprites do not bleed into their neighbours. Packed regions
+// never move: images loaded later are packed onto pages of their own. Atlases
+// may also be packed offline, saved, and opened at startup. Headless
+// simulations pack empty regions instead
+//================================================================================
+class TextureAtlas
+{
+// Methods
+private:
+    TextureAtlas(const TextureAtlas&);
+
+public:
+    TextureAtlas(unsigned size = 1024, unsigned padding = 1);
+    virtual ~TextureAtlas();
+
+    bool                    add(const std::string& filepath);
+    int                     pack();
+    const TextureRegion&    load(const std::string& filepath);
+    bool                    contains(const std::string& filepath) const;
+    int                     pages() const;
+    const sf::Texture&      page(int index) const;
+    bool                    save(const std::string& prefix) const;
+    bool                    open(const std::string& prefix);
+
+protected:
+    // Pending Image Sub-structure
+    struct Pending
+    {
+        std::string             filepath;
+        sf::Image               image;
+    };
+
+    sf::Texture*            addPage();
+    void                    blit(sf::Image& page, const sf::Image& image, unsigned x, unsigned y) const;
+
+// Members
+    unsigned                size_;
+    unsigned                padding_;
+    std::vector<Pending>    pending_;
+    std::map<std::string, TextureRegion> regions_;
+    std::vector<sf::Texture*> pages_;
+    sf::Texture             empty_;
+};
+
+#endif
\ No newline at end of file
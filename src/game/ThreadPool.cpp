@@ -0,0 +1,153 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+// - Thread Pool Constructor (private)
+//----------------------------------------------------------------------------
+// Starts one worker for each hardware thread besides the caller's
+//----------------------------------------------------------------------------
+ThreadPool::ThreadPool() :
+    task_(0),
+    count_(0),
+    next_(0),
+    busy_(0),
+    batch_(0),
+    closing_(false)
+{
+    int workers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+    for(int i = 0; i < workers; i++)
+    {
+        workers_.push_back(std::thread(&ThreadPool::work, this));
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Thread Pool Copy Constructor (private, empty)
+//----------------------------------------------------------------------------
+ThreadPool::ThreadPool(const ThreadPool& copy)
+{}
+
+//----------------------------------------------------------------------------
+// - Thread Pool Destructor
+//----------------------------------------------------------------------------
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        closing_ = true;
+    }
+
+    wake_.notify_all();
+
+    for(std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Thread Pool Single Instance
+//----------------------------------------------------------------------------
+ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool instance;
+    return instance;
+}
+
+//----------------------------------------------------------------------------
+// - Get Pool Size
+//----------------------------------------------------------------------------
+// Returns the number of threads taking part in a batch, including the caller
+//----------------------------------------------------------------------------
+int ThreadPool::size() const
+{
+    return workers_.size() + 1;
+}
+
+//----------------------------------------------------------------------------
+// - Parallel For
+//----------------------------------------------------------------------------
+// * count : number of work items, indexed from 0 to count - 1
+// * task : function run once per work item, possibly concurrently
+// Blocks until every work item has been run. Batches are not re-entrant; a
+// task must not start another batch
+//----------------------------------------------------------------------------
+void ThreadPool::parallelFor(int count, const std::function<void(int)>& task)
+{
+    if(count <= 0)
+    {
+        return;
+    }
+    else if(count == 1 || workers_.empty())
+    {
+        for(int i = 0; i < count; i++)
+        {
+            task(i);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        task_ = &task;
+        count_ = count;
+        next_ = 0;
+        busy_ = workers_.size();
+        batch_++;
+    }
+
+    wake_.notify_all();
+    drain();
+
+    // Wait for every worker to leave the batch before releasing the task
+    std::unique_lock<std::mutex> guard(lock_);
+    done_.wait(guard, [this](){return busy_ == 0;});
+    task_ = 0;
+}
+
+//----------------------------------------------------------------------------
+// - Worker Loop (private)
+//----------------------------------------------------------------------------
+void ThreadPool::work()
+{
+    unsigned seen = 0;
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock_);
+            wake_.wait(guard, [this, seen](){return closing_ || batch_ != seen;});
+
+            if(closing_)
+            {
+                return;
+            }
+
+            seen = batch_;
+        }
+
+        drain();
+
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            busy_--;
+        }
+
+        done_.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Drain Batch (private)
+//----------------------------------------------------------------------------
+// Claims and runs work items until none remain
+//----------------------------------------------------------------------------
+void ThreadPool::drain()
+{
+    for(int i = next_++; i < count_; i = next_++)
+    {
+        (*task_)(i);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef TACTICS_THREAD_POOL_H
+#define TACTICS_THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+//================================================================================
+// ** ThreadPool
+//================================================================================
+// Singleton pool of worker threads for data-parallel batches. The calling
+// thread joins in on each batch, and work items are claimed one at a time from
+// a shared atomic counter
+//================================================================================
+class ThreadPool
+{
+// Methods
+private:
+    ThreadPool();
+    ThreadPool(const ThreadPool& copy);
+
+public:
+    ~ThreadPool();
+
+    static ThreadPool&          instance();
+    int                         size() const;
+    void                        parallelFor(int count, const std::function<void(int)>& task);
+
+private:
+    void                        work();
+    void                        drain();
+
+// Members
+    std::vector<std::thread>    workers_;
+    std::mutex                  lock_;
+    std::condition_variable     wake_;
+    std::condition_variable     done_;
+    const std::function<void(int)>* task_;
+    int                         count_;
+    std::atomic<int>            next_;
+    int                         busy_;
+    unsigned                    batch_;
+    bool                        closing_;
+};
+
+#endif
\ No newline at end of file
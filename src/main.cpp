@@ -1,37 +1,135 @@
 #include "game/Scene.h"
 #include "game/InputManager.h"
 #include "game/Animations.h"
+#include "game/RedrawTracker.h"
+#include "game/Renderer.h"
+#include "game/Simulation.h"
+#include "control/InputRecorder.h"
+#include "settings.h"
+#include <algorithm>
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <ctime>
+#include <stdlib.h>
 
 //================================================================================
 // ** Tactics Main Game Loop
 //================================================================================
 // The main program loop. Here, the Scene is created, setup and drawn. Animations
 // are brought to life using the central game clock, and input is redirected to
-// the input manager using polling
+// the input manager using polling. The scene is only drawn again once something
+// visible has changed; idle frames sleep until the next one is due instead.
+// Frames are recorded into draw lists, and drawn by a render thread while the
+// next update runs. Options:
+//   --record <file> : save the input of the session for replay, along with
+//                     its seed, length and final state. The game then steps
+//                     at a fixed timestep, as replays do
+//   --seed <seed>   : seed of the game's random numbers, 1 by default
+//   --fps <limit>   : frames drawn per second at most, 0 for no limit
+//   --vsync         : wait for the monitor's vertical sync instead
+//   --always-draw   : draw every frame, to compare against idle-frame elision
+//   --serial        : draw on the game loop's thread, without draw lists
+//   --still         : keep the panoramas from drifting
+//   --quit-after <s>: close the game after so many seconds, so that idle runs
+//                     of each mode measure the same span
 //================================================================================
-int main()
+int main(int argc, char** argv)
 {
     std::cout << "Starting game ... " << std::endl;
 
-    // Main game window
+    std::string recording;
+    unsigned seed = 1;
+    unsigned limit = FRAME_LIMIT;
+    bool vsync = VSYNC;
+    bool elide = true;
+    bool serial = false;
+    bool still = false;
+    float quitAfter = 0;
+
+    for(int i = 1; i < argc; i++)
+    {
+        std::string option(argv[i]);
+
+        if(option == "--record" && i + 1 < argc)
+        {
+            recording = argv[++i];
+        }
+        else if(option == "--seed" && i + 1 < argc)
+        {
+            seed = strtoul(argv[++i], 0, 10);
+        }
+        else if(option == "--fps" && i + 1 < argc)
+        {
+            limit = strtoul(argv[++i], 0, 10);
+        }
+        else if(option == "--vsync")
+        {
+            vsync = true;
+        }
+        else if(option == "--always-draw")
+        {
+            elide = false;
+        }
+        else if(option == "--serial")
+        {
+            serial = true;
+        }
+        else if(option == "--still")
+        {
+            still = true;
+        }
+        else if(option == "--quit-after" && i + 1 < argc)
+        {
+            quitAfter = strtof(argv[++i], 0);
+        }
+    }
+
+    // Optional input recording, passing the keyboard through
+    InputRecorder recorder(InputManager::instance().getSource());
+
+    if(!recording.empty())
+    {
+        InputManager::instance().setSource(&recorder);
+    }
+
+    // Main game window, paced by either vertical sync or the frame limiter
     sf::RenderWindow window(sf::VideoMode(640, 480), "Tactics!");
+    window.setVerticalSyncEnabled(vsync);
+    window.setFramerateLimit(vsync ? 0 : limit);
+
+    // Skipped frames sleep out the rest of the frame themselves
+    sf::Time period = sf::seconds(1 / (limit > 0 && !vsync ? float(limit) : FPS));
     
     // Main game clock
     sf::Clock clock;
     float elapsed = 0;
 
-    // Initiate Scene
+    // Frame statistics
+    sf::Clock frameClock, playClock;
+    sf::Time drawing, longestRest;
+    unsigned long drawn = 0, skipped = 0;
+    std::clock_t cpuStart = std::clock();
+
+    // Recorded sessions step whole frames of the wall-clock time, so that a
+    // replay stepping the same frames sees the same polls
+    Simulation* simulation = recording.empty() ? 0 : new Simulation(seed, false);
+
+    // Initiate Scene, placing actors from the seeded random numbers
+    srand(seed);
     Scene scene;
     scene.start();
+
+    if(still)
+    {
+        scene.stillStaging();
+    }
+
+    // Render thread, taking over the window's GL context
+    Renderer* renderer = serial ? 0 : new Renderer(window);
     
-    while(window.isOpen())
+    while(window.isOpen() && !scene.closed())
     {
-        if(scene.closed())
-        {
-            window.close();
-        }
-        
         // Basic window event handling
         sf::Event event;
         while(window.pollEvent(event))
@@ -40,19 +138,109 @@ int main()
             {
                 scene.close();                
             }
+            else if(event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+            {
+                // The window's contents may have been lost
+                RedrawTracker::instance().request();
+            }
+        }
+
+        if(quitAfter > 0 && playClock.getElapsedTime().asSeconds() >= quitAfter)
+        {
+            scene.close();
         }
 
         // Timing updates
         elapsed = clock.restart().asSeconds();
-        Animations::instance().update(elapsed);
 
-        // Draw calls
-        window.clear(sf::Color::Black);
-        window.draw(scene);
-        window.display();
+        if(simulation)
+        {
+            simulation->advance(elapsed);
+        }
+        else
+        {
+            Animations::instance().update(elapsed);
+        }
+
+        // Draw calls, only once something visible changed
+        if(!elide || RedrawTracker::instance().take())
+        {
+            sf::Clock timer;
+
+            if(renderer)
+            {
+                DrawList& frame = renderer->record();
+                frame.draw(scene);
+                renderer->submit();
+            }
+            else
+            {
+                window.clear(sf::Color::Black);
+                window.draw(scene);
+                window.display();
+            }
+
+            drawing += timer.getElapsedTime();
+            drawn++;
+        }
+        else
+        {
+            sf::Time rest = period - frameClock.getElapsedTime();
+
+            // Events and keys are not read while asleep; the longest sleep,
+            // overshoot included, bounds the latency this adds to input
+            if(rest > sf::Time::Zero)
+            {
+                sf::Clock timer;
+                sf::sleep(rest);
+                longestRest = std::max(longestRest, timer.getElapsedTime());
+            }
+
+            skipped++;
+        }
+
+        frameClock.restart();
+    }
+
+    // The render thread finishes its last frame before the window closes
+    sf::Time rendering, waiting;
+
+    if(renderer)
+    {
+        rendering = renderer->rendering();
+        waiting = renderer->waiting();
+        delete renderer;
     }
+
+    window.close();
     
+    if(!recording.empty())
+    {
+        InputManager::instance().setSource(0);
+        std::cout << "Recorded " << recorder.polls().size() << " polls over " << simulation->frames() << " frames to " << recording
+            << (recorder.save(recording, seed, simulation->frames(), scene.hash()) ? "" : " (failed)") << std::endl;
+        delete simulation;
+    }
+
+    // Savings: frames never sent to the graphics card, and the share of a core
+    // the game kept busy
+    float played = playClock.getElapsedTime().asSeconds();
+    float cpu = float(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    unsigned long frames = drawn + skipped;
+
     std::cout << "Exiting game ... " << std::endl;
+    std::cout << "Dropped " << Animations::instance().droppedTime() << "s of elapsed time, " << Animations::instance().droppedSteps() << " steps" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Drew " << drawn << " of " << frames << " frames (" << (frames ? 100.0 * skipped / frames : 0) << "% skipped), "
+        << (drawn ? drawing.asSeconds() * 1000 / drawn : 0) << " ms per drawn frame, pacing included" << std::endl;
+    std::cout << "Slept at most " << longestRest.asSeconds() * 1000 << " ms on an idle frame, the most it delayed reading input" << std::endl;
+
+    if(!serial)
+    {
+        std::cout << "Render thread busy for " << rendering.asSeconds() << "s, game loop waited " << waiting.asSeconds() << "s on it" << std::endl;
+    }
+
+    std::cout << "Used " << cpu << "s of CPU time over " << played << "s (" << (played > 0 ? 100 * cpu / played : 0) << "% of a core)" << std::endl;
     
     return 0;
 }
\ No newline at end of file
@@ -224,7 +224,8 @@ int main()
         elapsed = clock.restart().asSeconds();
         Animations::instance().update(elapsed);
         window.clear(sf::Color::Black);
-        background.drawOverlays(window);
+        window.setView(window.getDefaultView());
+        window.draw(background);
         window.setView(view);
         window.draw(map);        
         window.draw(hud);
@@ -0,0 +1,299 @@
+#include "BitGrid.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+// - Bit Grid Constructor
+//----------------------------------------------------------------------------
+// * width : number of columns (x-axis) in the grid
+// * height : number of rows (y-axis) in the grid
+//----------------------------------------------------------------------------
+BitGrid::BitGrid(int width, int height) :
+    width_(std::max(0, width)),
+    height_(std::max(0, height)),
+    stride_((width_ + 63) / 64),
+    words_(stride_ * height_, 0)
+{}
+
+//----------------------------------------------------------------------------
+// - Bit Grid Destructor
+//----------------------------------------------------------------------------
+BitGrid::~BitGrid()
+{}
+
+//----------------------------------------------------------------------------
+// - Get Flag
+//----------------------------------------------------------------------------
+// * x : column of the flag
+// * y : row of the flag
+// Returns the flag at (x, y), or false if out of bounds
+//----------------------------------------------------------------------------
+bool BitGrid::get(int x, int y) const
+{
+    if(x < 0 || x >= width_ || y < 0 || y >= height_)
+    {
+        return false;
+    }
+
+    return (words_[y * stride_ + x / 64] >> (x % 64)) & 1;
+}
+
+//----------------------------------------------------------------------------
+// - Set Flag
+//----------------------------------------------------------------------------
+// * x : column of the flag
+// * y : row of the flag
+// * value : new state of the flag. Out-of-bounds positions are ignored
+//----------------------------------------------------------------------------
+void BitGrid::set(int x, int y, bool value)
+{
+    if(x < 0 || x >= width_ || y < 0 || y >= height_)
+    {
+        return;
+    }
+
+    uint64_t bit = uint64_t(1) << (x % 64);
+
+    if(value)
+    {
+        words_[y * stride_ + x / 64] |= bit;
+    }
+    else
+    {
+        words_[y * stride_ + x / 64] &= ~bit;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Clear All Flags
+//----------------------------------------------------------------------------
+void BitGrid::clear()
+{
+    std::fill(words_.begin(), words_.end(), 0);
+}
+
+//----------------------------------------------------------------------------
+// - Get Width
+//----------------------------------------------------------------------------
+int BitGrid::width() const
+{
+    return width_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Height
+//----------------------------------------------------------------------------
+int BitGrid::height() const
+{
+    return height_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Stride
+//----------------------------------------------------------------------------
+// Returns the number of 64-bit words per row
+//----------------------------------------------------------------------------
+int BitGrid::stride() const
+{
+    return stride_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Row (Const-Interface)
+//----------------------------------------------------------------------------
+// * y : index of the row, which must be in bounds
+//----------------------------------------------------------------------------
+const uint64_t* BitGrid::row(int y) const
+{
+    return &words_[y * stride_];
+}
+
+//----------------------------------------------------------------------------
+// - Get Row (Mutable Interface)
+//----------------------------------------------------------------------------
+uint64_t* BitGrid::row(int y)
+{
+    return &words_[y * stride_];
+}
+
+//----------------------------------------------------------------------------
+// - Mask With Grid
+//----------------------------------------------------------------------------
+// * other : grid of equal dimensions to mask this one with
+// * exclude : clears flags set in other if true, otherwise keeps only those
+//----------------------------------------------------------------------------
+void BitGrid::mask(const BitGrid& other, bool exclude)
+{
+    int n = std::min(words_.size(), other.words_.size());
+
+    for(int i = 0; i < n; i++)
+    {
+        words_[i] &= exclude ? ~other.words_[i] : other.words_[i];
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Set Positions
+//----------------------------------------------------------------------------
+// Returns every position whose flag is set, in row-major order
+//----------------------------------------------------------------------------
+std::vector<sf::Vector2f> BitGrid::positions() const
+{
+    std::vector<sf::Vector2f> set;
+
+    for(int y = 0; y < height_; y++)
+    {
+        for(int w = 0; w < stride_; w++)
+        {
+            uint64_t bits = words_[y * stride_ + w];
+
+            while(bits)
+            {
+                set.push_back(sf::Vector2f(w * 64 + __builtin_ctzll(bits), y));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    return set;
+}
+
+//----------------------------------------------------------------------------
+// - Merge With Grid
+//----------------------------------------------------------------------------
+// * other : grid of equal dimensions whose flags are added to this one
+//----------------------------------------------------------------------------
+void BitGrid::merge(const BitGrid& other)
+{
+    int n = std::min(words_.size(), other.words_.size());
+
+    for(int i = 0; i < n; i++)
+    {
+        words_[i] |= other.words_[i];
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Spread Flags
+//----------------------------------------------------------------------------
+// * open : grid of positions that flags may spread onto
+// * steps : number of orthogonal steps the set flags spread by
+//----------------------------------------------------------------------------
+void BitGrid::spread(const BitGrid& open, int steps)
+{
+    if(stride_ == 0 || height_ == 0 || open.words_.size() != words_.size())
+    {
+        return;
+    }
+
+    const uint64_t* entries[4] = {&open.words_[0], &open.words_[0], &open.words_[0], &open.words_[0]};
+    std::vector<uint64_t> window((height_ + 2) * stride_, 0);
+
+    std::copy(words_.begin(), words_.end(), window.begin() + stride_);
+    grow(window, entries, height_, stride_, steps);
+    std::copy(window.begin() + stride_, window.end() - stride_, words_.begin());
+}
+
+//----------------------------------------------------------------------------
+// - Flood Fill
+//----------------------------------------------------------------------------
+// * passable : grid of positions that may be entered
+// * origin : position the fill starts from, which need not be passable
+// * steps : maximum number of orthogonal steps taken from the origin
+// Returns the grid of every position reachable from the origin within the
+// given number of steps
+//----------------------------------------------------------------------------
+BitGrid BitGrid::flood(const BitGrid& passable, const sf::Vector2i& origin, int steps)
+{
+    return flood(passable, passable, passable, passable, origin, steps);
+}
+
+//----------------------------------------------------------------------------
+// - Flood Fill Along Edges
+//----------------------------------------------------------------------------
+// * east : grid of positions that may be entered by a step toward +x
+// * south : grid of positions that may be entered by a step toward +y
+// * west : grid of positions that may be entered by a step toward -x
+// * north : grid of positions that may be entered by a step toward -y
+// * origin : position the fill starts from
+// * steps : maximum number of orthogonal steps taken from the origin
+// Returns the grid of every position reachable from the origin within the
+// given number of steps. Only the rows within range of the origin are
+// processed
+//----------------------------------------------------------------------------
+BitGrid BitGrid::flood(const BitGrid& east, const BitGrid& south, const BitGrid& west, const BitGrid& north, const sf::Vector2i& origin, int steps)
+{
+    BitGrid reached(east.width_, east.height_);
+
+    if(origin.x < 0 || origin.x >= east.width_ || origin.y < 0 || origin.y >= east.height_)
+    {
+        return reached;
+    }
+
+    reached.set(origin.x, origin.y);
+    steps = std::max(0, steps);
+
+    int stride = east.stride_;
+    int top = std::max(0, origin.y - steps);
+    int bottom = std::min(east.height_ - 1, origin.y + steps);
+    int rows = bottom - top + 1;
+    const uint64_t* entries[4] = {&east.words_[top * stride], &south.words_[top * stride], &west.words_[top * stride], &north.words_[top * stride]};
+
+    // Window of rows [top, bottom], padded with one empty row above and below
+    std::vector<uint64_t> window((rows + 2) * stride, 0);
+
+    std::copy(reached.words_.begin() + top * stride, reached.words_.begin() + (bottom + 1) * stride, window.begin() + stride);
+    grow(window, entries, rows, stride, steps);
+    std::copy(window.begin() + stride, window.end() - stride, reached.words_.begin() + top * stride);
+
+    return reached;
+}
+
+//----------------------------------------------------------------------------
+// - Grow Window (protected)
+//----------------------------------------------------------------------------
+// * window : rows of flags to grow, padded with one empty row on each side
+// * entries : rows of positions that may be entered by a step toward +x, +y,
+//      -x and -y respectively, without padding
+// * rows : number of unpadded rows in the window
+// * stride : number of words per row
+// * steps : maximum number of growth steps
+// Each step shifts the set by one cell in each direction with whole-word
+// shifts, masking each shifted copy by the positions enterable that way. Stops
+// early once the set no longer grows
+//----------------------------------------------------------------------------
+void BitGrid::grow(std::vector<uint64_t>& window, const uint64_t* const entries[4], int rows, int stride, int steps)
+{
+    std::vector<uint64_t> next(window.size(), 0);
+    const uint64_t* east = entries[0];
+    const uint64_t* south = entries[1];
+    const uint64_t* west = entries[2];
+    const uint64_t* north = entries[3];
+    int count = rows * stride;
+
+    for(int s = 0; s < steps; s++)
+    {
+        const uint64_t* above = &window[0];
+        const uint64_t* cells = &window[stride];
+        const uint64_t* below = &window[2 * stride];
+        uint64_t* out = &next[stride];
+        uint64_t changed = 0;
+
+        for(int i = 0; i < count; i++)
+        {
+            int w = i % stride;
+            uint64_t fromWest = (cells[i] << 1) | (w > 0 ? cells[i - 1] >> 63 : 0);
+            uint64_t fromEast = (cells[i] >> 1) | (w < stride - 1 ? cells[i + 1] << 63 : 0);
+            uint64_t grown = cells[i] | (fromWest & east[i]) | (above[i] & south[i]) | (fromEast & west[i]) | (below[i] & north[i]);
+
+            changed |= grown ^ cells[i];
+            out[i] = grown;
+        }
+
+        window.swap(next);
+
+        if(!changed)
+        {
+            break;
+        }
+    }
+}
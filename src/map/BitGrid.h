@@ -0,0 +1,48 @@
+#ifndef TACTICS_BIT_GRID_H
+#define TACTICS_BIT_GRID_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <stdint.h>
+
+//================================================================================
+// ** BitGrid
+//================================================================================
+// Represents a 2-D grid of flags packed into rows of 64-bit words, where bit
+// (x % 64) of word (x / 64) in row y holds the flag at (x, y). Bits beyond the
+// grid's width are kept clear so that whole-word operations stay exact
+//================================================================================
+class BitGrid
+{
+// Methods
+public:
+    BitGrid(int width = 0, int height = 0);
+    virtual ~BitGrid();
+
+    bool                get(int x, int y) const;
+    void                set(int x, int y, bool value = true);
+    void                clear();
+    int                 width() const;
+    int                 height() const;
+    int                 stride() const;
+    const uint64_t*     row(int y) const;
+    uint64_t*           row(int y);
+    void                mask(const BitGrid& other, bool exclude = false);
+    void                merge(const BitGrid& other);
+    void                spread(const BitGrid& open, int steps);
+    std::vector<sf::Vector2f> positions() const;
+
+    static BitGrid      flood(const BitGrid& passable, const sf::Vector2i& origin, int steps);
+    static BitGrid      flood(const BitGrid& east, const BitGrid& south, const BitGrid& west, const BitGrid& north, const sf::Vector2i& origin, int steps);
+
+protected:
+    static void         grow(std::vector<uint64_t>& window, const uint64_t* const entries[4], int rows, int stride, int steps);
+
+// Members
+    int                 width_;
+    int                 height_;
+    int                 stride_;
+    std::vector<uint64_t> words_;
+};
+
+#endif
\ No newline at end of file
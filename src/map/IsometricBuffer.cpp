@@ -1,5 +1,7 @@
 #include "IsometricBuffer.h"
 #include "../settings.h"
+#include "../game/Simulation.h"
+#include "../game/RedrawTracker.h"
 #include <algorithm>
 
 //----------------------------------------------------------------------------
@@ -70,7 +72,9 @@ void IsometricBuffer::remove(IsometricNode* node)
             // Remove the node itself
             node_it = objects_.erase(node_it);
         }
-    }  
+    }
+
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -79,6 +83,7 @@ void IsometricBuffer::remove(IsometricNode* node)
 void IsometricBuffer::alert()
 {
     dirty_ = true;
+    wake();
 }
 
 //----------------------------------------------------------------------------
@@ -253,11 +258,12 @@ void IsometricBuffer::draw(sf::RenderTarget& target, sf::RenderStates states) co
 //----------------------------------------------------------------------------
 // - Increment Frame
 //----------------------------------------------------------------------------
-// Calls the isometric sort event if any nodes require re-sorting
+// Calls the isometric sort event if any nodes require re-sorting. Headless
+// simulations draw nothing, so they never sort
 //----------------------------------------------------------------------------
 void IsometricBuffer::step()
 {
-    if(dirty_){
+    if(dirty_ && !Simulation::headless()){
         std::vector<IsometricNode*> dirty;
 
         for(int n = 0; n < objects_.size(); n++)
@@ -279,5 +285,13 @@ void IsometricBuffer::step()
         {
             partialSort(dirty);
         }
-    }       
+
+        RedrawTracker::instance().request();
+    }
+
+    // Idle until alerted of a change
+    if(!dirty_ || Simulation::headless())
+    {
+        sleep();
+    }
 }
\ No newline at end of file
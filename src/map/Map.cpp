@@ -10,10 +10,15 @@
 //----------------------------------------------------------------------------
 Map::Map(int width, int length) :
     width_(std::max(1, width)),
-    length_(std::max(1, length))
+    length_(std::max(1, length)),
+    terrain_(width_, length_),
+    occupancy_(width_, length_)
 {
     tiles_.resize(width_, std::vector<std::vector<Tile*>>(length_));
 
+    // Default movement class, free to climb any height
+    addMovementClass(FLT_MAX);
+
     // 2-D player array
     actors_ = new Actor**[width_];
     for(int x = 0; x < width_; x++)
@@ -43,6 +48,11 @@ Map::~Map()
             }
         }
     }
+    for(PathHierarchy* paths : paths_)
+    {
+        delete paths;
+    }
+
     // Delete 3-D actor array (not the actors themselves)
     for(int i = 0; i < width(); i++){
         delete [] actors_[i];
@@ -132,6 +142,7 @@ bool Map::place(Tile* tile, int x, int y)
 
     tiles_[x][y].push_back(tile);
     images_.add(tile);
+    touch(x, y);
 
     return true;
 }
@@ -172,6 +183,7 @@ bool Map::insert(Tile* tile, int x, int y, int layer)
     tile->setPosition(sf::Vector3f(x, y, z));
     tiles_[x][y].insert(tiles_[x][y].begin() + layer, tile);
     images_.add(tile);
+    touch(x, y);
 
     return true;
 }
@@ -222,6 +234,7 @@ bool Map::replace(Tile* tile, int x, int y, int layer)
     delete tiles_[x][y][layer];
     tiles_[x][y][layer] = tile;
     images_.add(tile);
+    touch(x, y);
 
     return true;
 }
@@ -257,6 +270,7 @@ bool Map::remove(int x, int y, int layer)
     images_.remove(tiles_[x][y][layer]);
     delete tiles_[x][y][layer];
     tiles_[x][y].erase(tiles_[x][y].begin() + layer);
+    touch(x, y);
 
     return true;
 }
@@ -273,12 +287,12 @@ bool Map::valid(float x, float y) const
     int x_i = (int)round(x);
     int y_i = (int)round(y);
 
-    if((x < 0 || x >= width_) || (y < 0 || y >= length_))
+    if((x_i < 0 || x_i >= width_) || (y_i < 0 || y_i >= length_))
     {
         return false;
     }
     
-    return !tiles_[x][y].empty();
+    return !tiles_[x_i][y_i].empty();
 }
 
 //----------------------------------------------------------------------------
@@ -340,12 +354,160 @@ IsometricBuffer& Map::getDepthBuffer()
     return images_;
 }
 
+//----------------------------------------------------------------------------
+// - Get Hierarchical Path Planner
+//----------------------------------------------------------------------------
+// * movementClass : index of the movement class the planner is built for
+//----------------------------------------------------------------------------
+const PathHierarchy& Map::getPathHierarchy(int movementClass) const
+{
+    if(movementClass < 0 || movementClass >= paths_.size())
+    {
+        movementClass = 0;
+    }
+
+    return *paths_[movementClass];
+}
+
+//----------------------------------------------------------------------------
+// - Get Terrain Grid
+//----------------------------------------------------------------------------
+// Returns the packed grid of positions holding at least one tile
+//----------------------------------------------------------------------------
+const BitGrid& Map::getTerrain() const
+{
+    return terrain_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Occupancy Grid
+//----------------------------------------------------------------------------
+// Returns the packed grid of positions occupied by a player
+//----------------------------------------------------------------------------
+const BitGrid& Map::getOccupancy() const
+{
+    return occupancy_;
+}
+
+//----------------------------------------------------------------------------
+// - Add Movement Class
+//----------------------------------------------------------------------------
+// * jump : greatest height difference a single step may climb or drop
+// Returns the index of the new movement class, whose passability edges are
+// built for the whole map. Class 0 always exists, with no height limit
+//----------------------------------------------------------------------------
+int Map::addMovementClass(float jump)
+{
+    int movementClass = jumps_.size();
+
+    jumps_.push_back(jump);
+    edges_.push_back(std::vector<unsigned char>(width_ * length_, 0));
+
+    for(int d = 0; d < 4; d++)
+    {
+        entries_.push_back(BitGrid(width_, length_));
+    }
+
+    paths_.push_back(new PathHierarchy(this, movementClass));
+
+    for(int x = 0; x < width_; x++)
+    {
+        for(int y = 0; y < length_; y++)
+        {
+            buildEdges(x, y, movementClass);
+        }
+    }
+
+    return movementClass;
+}
+
+//----------------------------------------------------------------------------
+// - Get Number of Movement Classes
+//----------------------------------------------------------------------------
+int Map::movementClasses() const
+{
+    return jumps_.size();
+}
+
+//----------------------------------------------------------------------------
+// - Passable?
+//----------------------------------------------------------------------------
+// * from : position being traveled from
+// * to : adjacent position being traveled to
+// * movementClass : index of the movement class traveling
+// Returns whether a single step between the positions is allowed, read from
+// the precomputed edges for adjacent in-bounds positions
+//----------------------------------------------------------------------------
+bool Map::passable(const sf::Vector2f& from, const sf::Vector2f& to, int movementClass) const
+{
+    // Direction index by (dy + 1) * 3 + (dx + 1); -1 for non-orthogonal steps
+    static const int directions[9] = {-1, 3, -1, 2, -1, 0, -1, 1, -1};
+
+    int x = (int)round(from.x);
+    int y = (int)round(from.y);
+    int dx = (int)round(to.x) - x;
+    int dy = (int)round(to.y) - y;
+
+    if(movementClass < 0 || movementClass >= jumps_.size())
+    {
+        movementClass = 0;
+    }
+
+    if(abs(dx) > 1 || abs(dy) > 1 || directions[(dy + 1) * 3 + dx + 1] < 0)
+    {
+        return false;
+    }
+    else if(x < 0 || x >= width_ || y < 0 || y >= length_)
+    {
+        // Stepping onto the map from outside is only limited by the target
+        return jumps_[movementClass] == FLT_MAX && valid(to.x, to.y);
+    }
+
+    return (edges_[movementClass][y * width_ + x] >> directions[(dy + 1) * 3 + dx + 1]) & 1;
+}
+
+//----------------------------------------------------------------------------
+// - Get Passability Edges
+//----------------------------------------------------------------------------
+// * x : x-coordinate of the position stepped from
+// * y : y-coordinate of the position stepped from
+// * movementClass : index of the movement class traveling
+// Returns a 4-bit mask whose bit d is set if a step is allowed toward
+// direction d, counting 0 as +x, 1 as +y, 2 as -x and 3 as -y
+//----------------------------------------------------------------------------
+unsigned char Map::edges(int x, int y, int movementClass) const
+{
+    if(x < 0 || x >= width_ || y < 0 || y >= length_ || movementClass < 0 || movementClass >= jumps_.size())
+    {
+        return 0;
+    }
+
+    return edges_[movementClass][y * width_ + x];
+}
+
+//----------------------------------------------------------------------------
+// - Get Entry Grids
+//----------------------------------------------------------------------------
+// * movementClass : index of the movement class traveling
+// Returns the four packed grids of positions that may be entered by a single
+// step toward +x, +y, -x and -y respectively
+//----------------------------------------------------------------------------
+const BitGrid* Map::getEntries(int movementClass) const
+{
+    if(movementClass < 0 || movementClass >= jumps_.size())
+    {
+        movementClass = 0;
+    }
+
+    return &entries_[movementClass * 4];
+}
+
 //----------------------------------------------------------------------------
 // - Get Player At Position
 //----------------------------------------------------------------------------
 Actor* Map::playerAt(int x, int y) const
 {
-    if((x >= 0 && x < width_) || (y >= 0 || y < length_))    
+    if((x >= 0 && x < width_) && (y >= 0 && y < length_))    
     {
         return actors_[x][y];
     }
@@ -363,9 +525,10 @@ Actor* Map::playerAt(int x, int y) const
 //----------------------------------------------------------------------------
 void Map::enter(Actor* actor, int x, int y)
 {
-    if((x >= 0 && x < width_) || (y >= 0 || y < length_))
+    if((x >= 0 && x < width_) && (y >= 0 && y < length_))
     {
-        actors_[x][y] = actor;        
+        actors_[x][y] = actor;
+        occupancy_.set(x, y, actor != 0);
     }
 }
 
@@ -377,12 +540,98 @@ void Map::enter(Actor* actor, int x, int y)
 //----------------------------------------------------------------------------
 void Map::exit(int x, int y)
 {
-    if((x >= 0 && x < width_) || (y >= 0 || y < length_))
+    if((x >= 0 && x < width_) && (y >= 0 && y < length_))
+    {
+        actors_[x][y] = 0;
+        occupancy_.set(x, y, false);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Touch Position (protected)
+//----------------------------------------------------------------------------
+// * x : x-coordinate of a position whose tiles were edited
+// * y : y-coordinate of a position whose tiles were edited
+// Keeps the terrain grid and path planner in sync with the tile columns
+//----------------------------------------------------------------------------
+void Map::touch(int x, int y)
+{
+    terrain_.set(x, y, !tiles_[x][y].empty());
+
+    // Only edges joining (x, y) to its neighbors can have changed
+    for(int c = 0; c < jumps_.size(); c++)
     {
-        actors_[x][y] = 0;        
+        buildEdges(x, y, c);
+        buildEdges(x + 1, y, c);
+        buildEdges(x, y + 1, c);
+        buildEdges(x - 1, y, c);
+        buildEdges(x, y - 1, c);
+        paths_[c]->alert(x, y);
     }
 }
 
+//----------------------------------------------------------------------------
+// - Step Allowed? (protected)
+//----------------------------------------------------------------------------
+// * x : x-coordinate of the position stepped from
+// * y : y-coordinate of the position stepped from
+// * direction : direction of the step, counting 0 as +x, clockwise
+// * movementClass : index of the movement class traveling
+// Evaluates the passability rule itself: the target must hold a tile, and
+// unless the class may climb freely, both ends must lie within its jump
+//----------------------------------------------------------------------------
+bool Map::step(int x, int y, int direction, int movementClass) const
+{
+    static const int offsets[4][2] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+
+    int tx = x + offsets[direction][0];
+    int ty = y + offsets[direction][1];
+
+    if(!valid(tx, ty))
+    {
+        return false;
+    }
+    else if(jumps_[movementClass] == FLT_MAX)
+    {
+        return true;
+    }
+    else if(!valid(x, y))
+    {
+        return false;
+    }
+
+    return fabs(height(tx, ty) - height(x, y)) <= jumps_[movementClass];
+}
+
+//----------------------------------------------------------------------------
+// - Build Passability Edges (protected)
+//----------------------------------------------------------------------------
+// * x : x-coordinate of the position whose outgoing edges are rebuilt
+// * y : y-coordinate of the position whose outgoing edges are rebuilt
+// * movementClass : index of the movement class to rebuild for
+//----------------------------------------------------------------------------
+void Map::buildEdges(int x, int y, int movementClass)
+{
+    static const int offsets[4][2] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+
+    if(x < 0 || x >= width_ || y < 0 || y >= length_)
+    {
+        return;
+    }
+
+    unsigned char mask = 0;
+
+    for(int d = 0; d < 4; d++)
+    {
+        bool allowed = step(x, y, d, movementClass);
+
+        mask |= allowed << d;
+        entries_[movementClass * 4 + d].set(x + offsets[d][0], y + offsets[d][1], allowed);
+    }
+
+    edges_[movementClass][y * width_ + x] = mask;
+}
+
 //----------------------------------------------------------------------------
 // - Draw (Override)
 //----------------------------------------------------------------------------
@@ -6,6 +6,8 @@
 #include <float.h>
 #include "Tile.h"
 #include "IsometricBuffer.h"
+#include "PathHierarchy.h"
+#include "BitGrid.h"
 
 class Actor;
 
@@ -34,6 +36,14 @@ public:
     int                 width() const;
     int                 length() const;
     IsometricBuffer&    getDepthBuffer();
+    const PathHierarchy& getPathHierarchy(int movementClass = 0) const;
+    const BitGrid&      getTerrain() const;
+    const BitGrid&      getOccupancy() const;
+    int                 addMovementClass(float jump);
+    int                 movementClasses() const;
+    bool                passable(const sf::Vector2f& from, const sf::Vector2f& to, int movementClass = 0) const;
+    unsigned char       edges(int x, int y, int movementClass = 0) const;
+    const BitGrid*      getEntries(int movementClass = 0) const;
     Actor*              playerAt(int x, int y) const;
     void                enter(Actor* actor, int x, int y);
     void                exit(int x, int y);
@@ -41,6 +51,9 @@ public:
 protected:
     virtual void        draw(sf::RenderTarget& target, sf::RenderStates states) const;
     Tile*               getTileAt(int x, int y, float z = FLT_MAX) const;
+    void                touch(int x, int y);
+    bool                step(int x, int y, int direction, int movementClass) const;
+    void                buildEdges(int x, int y, int movementClass);
 
 // Members
     int                 width_;
@@ -48,6 +61,12 @@ protected:
     IsometricBuffer     images_;
     std::vector<std::vector<std::vector<Tile*>>> tiles_;
     Actor***            actors_;
+    std::vector<PathHierarchy*> paths_;
+    BitGrid             terrain_;
+    BitGrid             occupancy_;
+    std::vector<float>  jumps_;
+    std::vector<std::vector<unsigned char>> edges_;
+    std::vector<BitGrid> entries_;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,924 @@
+#include "PathHierarchy.h"
+#include "Map.h"
+#include <algorithm>
+#include <queue>
+#include <math.h>
+
+//----------------------------------------------------------------------------
+// - Path Hierarchy Constructor
+//----------------------------------------------------------------------------
+// * map : map whose terrain is abstracted into clusters and entrances
+// * movementClass : index of the map movement class the graph is built for
+// * clusterSize : width and length of a single square cluster in tiles
+//----------------------------------------------------------------------------
+PathHierarchy::PathHierarchy(const Map* map, int movementClass, int clusterSize) :
+    map_(map),
+    movementClass_(movementClass),
+    clusterSize_(std::max(2, clusterSize)),
+    columns_((map->width() + clusterSize_ - 1) / clusterSize_),
+    rows_((map->length() + clusterSize_ - 1) / clusterSize_),
+    stride_(4 * clusterSize_),
+    dirty_(true),
+    clusters_(columns_ * rows_),
+    eastBorders_(columns_ * rows_),
+    southBorders_(columns_ * rows_),
+    searches_(0),
+    distance_(clusterSize_ * clusterSize_),
+    parent_(clusterSize_ * clusterSize_),
+    queue_(clusterSize_ * clusterSize_)
+{
+    // Each cluster owns a fixed block of entrance ids, so that rebuilding one
+    // leaves the ids of every other cluster untouched. A border of n cells
+    // holds at most n entrances, hence four borders' worth per block
+    nodes_.resize(clusters_.size() * stride_);
+    components_.assign(nodes_.size(), -1);
+
+    for(int c = 0; c < clusters_.size(); c++)
+    {
+        int left = (c % columns_) * clusterSize_;
+        int top = (c / columns_) * clusterSize_;
+
+        clusters_[c].bounds = sf::IntRect(left, top,
+            std::min(clusterSize_, map->width() - left),
+            std::min(clusterSize_, map->length() - top));
+        clusters_[c].first = c * stride_;
+        clusters_[c].dirty = true;
+        edited_.push_back(c);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Path Hierarchy Destructor
+//----------------------------------------------------------------------------
+PathHierarchy::~PathHierarchy()
+{}
+
+//----------------------------------------------------------------------------
+// - Find Path
+//----------------------------------------------------------------------------
+// * source : position the path starts from
+// * destination : position the path leads to
+// * passable : per-cell passability rule used to refine the abstract path.
+//      If omitted, the hierarchy's own rule is used
+// Returns a deque of consecutive positions from the source to the destination
+// (both inclusive), or an empty deque if no path exists
+//----------------------------------------------------------------------------
+std::deque<sf::Vector2f> PathHierarchy::findPath(const sf::Vector2f& source, const sf::Vector2f& destination, const Passability& passable) const
+{
+    std::deque<sf::Vector2f> path;
+    sf::Vector2i s((int)round(source.x), (int)round(source.y));
+    sf::Vector2i g((int)round(destination.x), (int)round(destination.y));
+
+    if(s == g || !map_->valid(s.x, s.y) || !map_->valid(g.x, g.y))
+    {
+        return path;
+    }
+
+    Passability rule = passable;
+    if(!rule)
+    {
+        rule = [this](const sf::Vector2f& from, const sf::Vector2f& to){return this->passable(from, to);};
+    }
+
+    refresh();
+
+    int cs = clusterAt(s.x, s.y);
+    int cg = clusterAt(g.x, g.y);
+    const Cluster& start = clusters_[cs];
+    const Cluster& goal = clusters_[cg];
+
+    // Sources and destinations sharing a cluster are usually joined locally
+    if(cs == cg && refine(start.bounds, s, g, rule, path))
+    {
+        path.push_front(sf::Vector2f(s.x, s.y));
+        return path;
+    }
+    path.clear();
+
+    // Temporary edges joining the source and destination to their clusters
+    std::vector<int> startCost(start.entrances.size()), goalCost(goal.entrances.size());
+
+    flood(start.bounds, s, false);
+    for(int i = 0; i < start.entrances.size(); i++)
+    {
+        const sf::Vector2i& e = start.entrances[i];
+        startCost[i] = distance_[(e.x - start.bounds.left) + (e.y - start.bounds.top) * start.bounds.width];
+    }
+
+    flood(goal.bounds, g, true);
+    for(int i = 0; i < goal.entrances.size(); i++)
+    {
+        const sf::Vector2i& e = goal.entrances[i];
+        goalCost[i] = distance_[(e.x - goal.bounds.left) + (e.y - goal.bounds.top) * goal.bounds.width];
+    }
+
+    // Without a shared component, the search would only exhaust the source's
+    bool joined = false;
+    for(int i = 0; i < start.entrances.size() && !joined; i++)
+    {
+        for(int j = 0; j < goal.entrances.size() && !joined; j++)
+        {
+            joined = startCost[i] >= 0 && goalCost[j] >= 0 && find(components_[start.first + i]) == find(components_[goal.first + j]);
+        }
+    }
+
+    if(!joined)
+    {
+        return path;
+    }
+
+    // A* search over the abstract entrance graph. Entrances are numbered
+    // within their cluster's block; the source and destination take the last
+    // two ids
+    int nodes = nodes_.size();
+    int sourceId = nodes;
+    int goalId = nodes + 1;
+    std::priority_queue<std::pair<float, int>, std::vector<std::pair<float, int>>, std::greater<std::pair<float, int>>> open;
+
+    // Records left by earlier searches are recognized by their stale stamp
+    records_.resize(nodes + 2, Record{0, -1, 0, false});
+    searches_++;
+
+    auto relax = [&](int id, int parent, int cost)
+    {
+        Record& record = records_[id];
+        if(record.search != searches_ || (!record.closed && cost < record.cost))
+        {
+            const sf::Vector2i& cell = id == goalId ? g : nodes_[id];
+
+            record = Record{cost, parent, searches_, false};
+            open.push(std::make_pair(cost + PATH_GREED * (abs(cell.x - g.x) + abs(cell.y - g.y)), id));
+        }
+    };
+
+    records_[sourceId] = Record{0, -1, searches_, false};
+    open.push(std::make_pair(0.0f, sourceId));
+
+    bool found = false;
+
+    while(!open.empty())
+    {
+        int id = open.top().second;
+        open.pop();
+
+        Record& record = records_[id];
+        if(record.closed)
+        {
+            continue;
+        }
+        record.closed = true;
+
+        if(id == goalId)
+        {
+            found = true;
+            break;
+        }
+
+        int cost = record.cost;
+
+        if(id == sourceId)
+        {
+            for(int i = 0; i < start.entrances.size(); i++)
+            {
+                if(startCost[i] >= 0)
+                {
+                    relax(start.first + i, id, cost + startCost[i]);
+                }
+            }
+            continue;
+        }
+
+        int c = id / stride_;
+        const Cluster& cluster = clusters_[c];
+        int index = id - cluster.first;
+        int n = cluster.entrances.size();
+
+        // Intra-cluster edges
+        for(int j = 0; j < n; j++)
+        {
+            int d = cluster.distances[index * n + j];
+            if(j != index && d >= 0)
+            {
+                relax(cluster.first + j, id, cost + d);
+            }
+        }
+
+        // Inter-cluster edges
+        for(int l = 0; l < 2; l++)
+        {
+            if(cluster.links[index * 2 + l] >= 0)
+            {
+                relax(cluster.links[index * 2 + l], id, cost + 1);
+            }
+        }
+
+        // Edge to the destination
+        if(c == cg && goalCost[index] >= 0)
+        {
+            relax(goalId, id, cost + goalCost[index]);
+        }
+    }
+
+    if(!found)
+    {
+        return path;
+    }
+
+    // Trace the abstract path backward from the destination
+    std::vector<sf::Vector2i> waypoints;
+    for(int id = goalId; id != -1; id = records_[id].parent)
+    {
+        waypoints.push_back(id == goalId ? g : id == sourceId ? s : nodes_[id]);
+    }
+    std::reverse(waypoints.begin(), waypoints.end());
+
+    // Refine each abstract edge into consecutive cells
+    path.push_back(sf::Vector2f(s.x, s.y));
+
+    for(int w = 1; w < waypoints.size(); w++)
+    {
+        const sf::Vector2i& from = waypoints[w - 1];
+        const sf::Vector2i& to = waypoints[w];
+        int c = clusterAt(from.x, from.y);
+
+        if(c != clusterAt(to.x, to.y))
+        {
+            if(!rule(sf::Vector2f(from.x, from.y), sf::Vector2f(to.x, to.y)))
+            {
+                return std::deque<sf::Vector2f>();
+            }
+            path.push_back(sf::Vector2f(to.x, to.y));
+        }
+        else if(!refine(clusters_[c].bounds, from, to, rule, path))
+        {
+            return std::deque<sf::Vector2f>();
+        }
+    }
+
+    return path;
+}
+
+//----------------------------------------------------------------------------
+// - Alert of Map Edit
+//----------------------------------------------------------------------------
+// * x : x-coordinate of the edited map position
+// * y : y-coordinate of the edited map position
+// Flags the cluster containing the position for rebuilding before the next
+// path query
+//----------------------------------------------------------------------------
+void PathHierarchy::alert(int x, int y)
+{
+    int c = clusterAt(x, y);
+
+    if(c >= 0 && !clusters_[c].dirty)
+    {
+        clusters_[c].dirty = true;
+        edited_.push_back(c);
+        dirty_ = true;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Cluster Size
+//----------------------------------------------------------------------------
+int PathHierarchy::getClusterSize() const
+{
+    return clusterSize_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Movement Class
+//----------------------------------------------------------------------------
+int PathHierarchy::getMovementClass() const
+{
+    return movementClass_;
+}
+
+//----------------------------------------------------------------------------
+// - Refresh Abstract Graph
+//----------------------------------------------------------------------------
+// Re-scans the borders of every edited cluster, then rebuilds the entrances
+// and intra-cluster distances of each cluster sharing one of those borders,
+// and relinks them and their neighbors. Components are merged in place unless
+// an entrance, distance or link the rebuilt clusters had is gone, in which
+// case a component may have split and the whole graph is relabeled
+//----------------------------------------------------------------------------
+void PathHierarchy::refresh() const
+{
+    if(!dirty_)
+    {
+        return;
+    }
+
+    // Abstract graph of a rebuilt cluster as it stood before the edit
+    struct Snapshot
+    {
+        std::vector<sf::Vector2i>   entrances;
+        std::vector<int>            distances;
+        std::vector<sf::Vector2i>   twins;
+        std::vector<int>            components;
+    };
+
+    std::vector<int> affected, relinked;
+
+    for(int c : edited_)
+    {
+        int column = c % columns_;
+        int row = c / columns_;
+
+        scanBorder(c, true);
+        scanBorder(c, false);
+        affected.push_back(c);
+
+        if(column > 0)
+        {
+            scanBorder(c - 1, true);
+            affected.push_back(c - 1);
+        }
+        if(row > 0)
+        {
+            scanBorder(c - columns_, false);
+            affected.push_back(c - columns_);
+        }
+        if(column < columns_ - 1)
+        {
+            affected.push_back(c + 1);
+        }
+        if(row < rows_ - 1)
+        {
+            affected.push_back(c + columns_);
+        }
+
+        clusters_[c].dirty = false;
+    }
+    edited_.clear();
+
+    std::sort(affected.begin(), affected.end());
+    affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+
+    // Links into a rebuilt cluster also leave from its neighbors
+    for(int c : affected)
+    {
+        relinked.push_back(c);
+
+        if(c % columns_ > 0)
+        {
+            relinked.push_back(c - 1);
+        }
+        if(c / columns_ > 0)
+        {
+            relinked.push_back(c - columns_);
+        }
+        if(c % columns_ < columns_ - 1)
+        {
+            relinked.push_back(c + 1);
+        }
+        if(c / columns_ < rows_ - 1)
+        {
+            relinked.push_back(c + columns_);
+        }
+    }
+
+    std::sort(relinked.begin(), relinked.end());
+    relinked.erase(std::unique(relinked.begin(), relinked.end()), relinked.end());
+
+    // The first build has no components to repair
+    bool split = labels_.empty();
+    std::vector<Snapshot> before(split ? 0 : affected.size());
+
+    for(int a = 0; a < before.size(); a++)
+    {
+        const Cluster& cluster = clusters_[affected[a]];
+        Snapshot& snapshot = before[a];
+
+        snapshot.entrances = cluster.entrances;
+        snapshot.distances = cluster.distances;
+        snapshot.twins.assign(cluster.links.size(), sf::Vector2i(-1, -1));
+        snapshot.components.assign(components_.begin() + cluster.first, components_.begin() + cluster.first + cluster.entrances.size());
+
+        for(int l = 0; l < cluster.links.size(); l++)
+        {
+            if(cluster.links[l] >= 0)
+            {
+                snapshot.twins[l] = nodes_[cluster.links[l]];
+            }
+        }
+    }
+
+    for(int c : affected)
+    {
+        rebuild(c);
+    }
+
+    for(int c : relinked)
+    {
+        link(c);
+    }
+
+    // Carry each surviving entrance's component over to its new id, giving
+    // new entrances a component of their own
+    for(int a = 0; a < before.size() && !split; a++)
+    {
+        const Cluster& cluster = clusters_[affected[a]];
+        const Snapshot& snapshot = before[a];
+        int n = snapshot.entrances.size();
+        int m = cluster.entrances.size();
+        std::vector<int> moved(n);
+
+        for(int i = 0; i < m; i++)
+        {
+            components_[cluster.first + i] = -1;
+        }
+
+        for(int i = 0; i < n && !split; i++)
+        {
+            moved[i] = entranceIndex(cluster, snapshot.entrances[i]);
+            split = moved[i] < 0;
+
+            if(!split)
+            {
+                components_[cluster.first + moved[i]] = snapshot.components[i];
+            }
+        }
+
+        for(int i = 0; i < n && !split; i++)
+        {
+            for(int j = 0; j < n && !split; j++)
+            {
+                split = snapshot.distances[i * n + j] >= 0 && cluster.distances[moved[i] * m + moved[j]] < 0;
+            }
+
+            for(int l = 0; l < 2 && !split; l++)
+            {
+                const sf::Vector2i& twin = snapshot.twins[i * 2 + l];
+                int first = cluster.links[moved[i] * 2];
+                int second = cluster.links[moved[i] * 2 + 1];
+
+                split = twin.x >= 0 && !(first >= 0 && nodes_[first] == twin) && !(second >= 0 && nodes_[second] == twin);
+            }
+        }
+
+        for(int i = 0; i < m; i++)
+        {
+            if(components_[cluster.first + i] < 0)
+            {
+                components_[cluster.first + i] = labels_.size();
+                labels_.push_back(labels_.size());
+            }
+        }
+    }
+
+    // Labels only accumulate between relabels; bound them by the id space
+    if(split || labels_.size() > nodes_.size())
+    {
+        label();
+    }
+    else
+    {
+        for(int c : affected)
+        {
+            const Cluster& cluster = clusters_[c];
+            int n = cluster.entrances.size();
+
+            for(int i = 0; i < n; i++)
+            {
+                for(int j = i + 1; j < n; j++)
+                {
+                    if(cluster.distances[i * n + j] >= 0 || cluster.distances[j * n + i] >= 0)
+                    {
+                        unite(components_[cluster.first + i], components_[cluster.first + j]);
+                    }
+                }
+            }
+        }
+
+        for(int c : relinked)
+        {
+            const Cluster& cluster = clusters_[c];
+
+            for(int l = 0; l < cluster.links.size(); l++)
+            {
+                if(cluster.links[l] >= 0)
+                {
+                    unite(components_[cluster.first + l / 2], components_[cluster.links[l]]);
+                }
+            }
+        }
+    }
+
+    dirty_ = false;
+}
+
+//----------------------------------------------------------------------------
+// - Base Passability Rule
+//----------------------------------------------------------------------------
+// * from : position being traveled from
+// * to : position being traveled to
+// Rule used to build the abstract graph, that of the hierarchy's movement class
+//----------------------------------------------------------------------------
+bool PathHierarchy::passable(const sf::Vector2f& from, const sf::Vector2f& to) const
+{
+    return map_->passable(from, to, movementClass_);
+}
+
+//----------------------------------------------------------------------------
+// - Get Cluster At Position (private)
+//----------------------------------------------------------------------------
+// Returns the index of the cluster containing (x, y), or -1 if out of bounds
+//----------------------------------------------------------------------------
+int PathHierarchy::clusterAt(int x, int y) const
+{
+    if(x < 0 || y < 0 || x >= map_->width() || y >= map_->length())
+    {
+        return -1;
+    }
+
+    return x / clusterSize_ + (y / clusterSize_) * columns_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Entrance Index (private)
+//----------------------------------------------------------------------------
+// Returns the index of the cell within the cluster's entrances, or -1
+//----------------------------------------------------------------------------
+int PathHierarchy::entranceIndex(const Cluster& cluster, const sf::Vector2i& cell) const
+{
+    for(int i = 0; i < cluster.entrances.size(); i++)
+    {
+        if(cluster.entrances[i] == cell)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+//----------------------------------------------------------------------------
+// - Scan Cluster Border (private)
+//----------------------------------------------------------------------------
+// * cluster : cluster whose east or south border is scanned
+// * east : scans the eastern border if set, the southern border otherwise
+// Splits the border into maximal open, connected runs, placing one entrance in
+// the middle of short runs and one at each end of long runs
+//----------------------------------------------------------------------------
+void PathHierarchy::scanBorder(int cluster, bool east) const
+{
+    std::vector<sf::Vector2i>& border = (east ? eastBorders_ : southBorders_)[cluster];
+    const sf::IntRect& bounds = clusters_[cluster].bounds;
+    border.clear();
+
+    // No neighbor beyond the edge of the map
+    if((east && cluster % columns_ == columns_ - 1) || (!east && cluster / columns_ == rows_ - 1))
+    {
+        return;
+    }
+
+    sf::Vector2i step = east ? sf::Vector2i(0, 1) : sf::Vector2i(1, 0);
+    sf::Vector2i across = east ? sf::Vector2i(1, 0) : sf::Vector2i(0, 1);
+    sf::Vector2i cell = east ? sf::Vector2i(bounds.left + bounds.width - 1, bounds.top) : sf::Vector2i(bounds.left, bounds.top + bounds.height - 1);
+    int length = east ? bounds.height : bounds.width;
+    int run = 0;
+
+    for(int i = 0; i <= length; i++, cell += step)
+    {
+        bool open = i < length && connected(cell, cell + across);
+
+        // Runs also break where the border cells on either side are not
+        // connected to their predecessors, so that every crossing point stays
+        // reachable from its run's entrances
+        bool continued = open && run > 0 && connected(cell - step, cell) && connected(cell - step + across, cell + across);
+
+        if(run > 0 && !continued)
+        {
+            sf::Vector2i last = cell - step;
+            sf::Vector2i first(last.x - step.x * (run - 1), last.y - step.y * (run - 1));
+
+            if(run < 6)
+            {
+                border.push_back(sf::Vector2i(first.x + step.x * (run / 2), first.y + step.y * (run / 2)));
+            }
+            else
+            {
+                border.push_back(first);
+                border.push_back(last);
+            }
+
+            run = 0;
+        }
+
+        if(open)
+        {
+            run++;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Rebuild Cluster (private)
+//----------------------------------------------------------------------------
+// * cluster : cluster whose entrances and intra-cluster distances are rebuilt
+//----------------------------------------------------------------------------
+void PathHierarchy::rebuild(int cluster) const
+{
+    Cluster& target = clusters_[cluster];
+    std::vector<sf::Vector2i>& entrances = target.entrances;
+    int column = cluster % columns_;
+    int row = cluster / columns_;
+
+    entrances = eastBorders_[cluster];
+    entrances.insert(entrances.end(), southBorders_[cluster].begin(), southBorders_[cluster].end());
+
+    if(column > 0)
+    {
+        for(const sf::Vector2i& cell : eastBorders_[cluster - 1])
+        {
+            entrances.push_back(cell + sf::Vector2i(1, 0));
+        }
+    }
+    if(row > 0)
+    {
+        for(const sf::Vector2i& cell : southBorders_[cluster - columns_])
+        {
+            entrances.push_back(cell + sf::Vector2i(0, 1));
+        }
+    }
+
+    // Corner cells may open onto two borders
+    for(int i = 0; i < entrances.size(); i++)
+    {
+        for(int j = entrances.size() - 1; j > i; j--)
+        {
+            if(entrances[j] == entrances[i])
+            {
+                entrances.erase(entrances.begin() + j);
+            }
+        }
+    }
+
+    int n = entrances.size();
+    target.distances.assign(n * n, -1);
+    std::copy(entrances.begin(), entrances.end(), nodes_.begin() + target.first);
+
+    for(int i = 0; i < n; i++)
+    {
+        flood(target.bounds, entrances[i], false);
+
+        for(int j = 0; j < n; j++)
+        {
+            target.distances[i * n + j] = distance_[(entrances[j].x - target.bounds.left) + (entrances[j].y - target.bounds.top) * target.bounds.width];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Link Cluster (private)
+//----------------------------------------------------------------------------
+// * cluster : cluster whose entrances are linked to their neighbors'
+// Links each entrance to the entrances it is connected to across a cluster
+// border. A cell lies on at most two borders, so each entrance has two link
+// slots, -1 when unused
+//----------------------------------------------------------------------------
+void PathHierarchy::link(int cluster) const
+{
+    const sf::Vector2i offsets[4] = {sf::Vector2i(1, 0), sf::Vector2i(-1, 0), sf::Vector2i(0, 1), sf::Vector2i(0, -1)};
+    Cluster& target = clusters_[cluster];
+
+    target.links.assign(target.entrances.size() * 2, -1);
+
+    for(int i = 0; i < target.entrances.size(); i++)
+    {
+        const sf::Vector2i& cell = target.entrances[i];
+        int l = 0;
+
+        for(int o = 0; o < 4; o++)
+        {
+            sf::Vector2i twin = cell + offsets[o];
+            int t = clusterAt(twin.x, twin.y);
+
+            if(t < 0 || t == cluster)
+            {
+                continue;
+            }
+
+            int index = entranceIndex(clusters_[t], twin);
+            if(index >= 0 && connected(cell, twin))
+            {
+                target.links[i * 2 + l++] = clusters_[t].first + index;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Label Components (private)
+//----------------------------------------------------------------------------
+// Labels every entrance by weakly connected component, flooding the whole
+// abstract graph, so that queries between components fail without a search
+//----------------------------------------------------------------------------
+void PathHierarchy::label() const
+{
+    std::vector<int> stack;
+
+    components_.assign(nodes_.size(), -1);
+    labels_.clear();
+
+    for(const Cluster& owner : clusters_)
+    {
+        for(int root = owner.first; root < owner.first + owner.entrances.size(); root++)
+        {
+            if(components_[root] >= 0)
+            {
+                continue;
+            }
+
+            int label = labels_.size();
+            labels_.push_back(label);
+            components_[root] = label;
+            stack.push_back(root);
+
+            while(!stack.empty())
+            {
+                int id = stack.back();
+                stack.pop_back();
+
+                const Cluster& cluster = clusters_[id / stride_];
+                int index = id - cluster.first;
+                int n = cluster.entrances.size();
+
+                for(int j = 0; j < n; j++)
+                {
+                    int next = cluster.first + j;
+                    if(components_[next] < 0 && (cluster.distances[index * n + j] >= 0 || cluster.distances[j * n + index] >= 0))
+                    {
+                        components_[next] = label;
+                        stack.push_back(next);
+                    }
+                }
+
+                for(int l = 0; l < 2; l++)
+                {
+                    int next = cluster.links[index * 2 + l];
+                    if(next >= 0 && components_[next] < 0)
+                    {
+                        components_[next] = label;
+                        stack.push_back(next);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Find Component (private)
+//----------------------------------------------------------------------------
+// * label : component label of an entrance
+// Returns the label standing for every component merged with the given one
+//----------------------------------------------------------------------------
+int PathHierarchy::find(int label) const
+{
+    while(labels_[label] != label)
+    {
+        labels_[label] = labels_[labels_[label]];
+        label = labels_[label];
+    }
+
+    return label;
+}
+
+//----------------------------------------------------------------------------
+// - Unite Components (private)
+//----------------------------------------------------------------------------
+// * a : component label of an entrance
+// * b : component label of an entrance joined to the first
+//----------------------------------------------------------------------------
+void PathHierarchy::unite(int a, int b) const
+{
+    a = find(a);
+    b = find(b);
+
+    if(a != b)
+    {
+        labels_[std::max(a, b)] = std::min(a, b);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Cells Connected? (private)
+//----------------------------------------------------------------------------
+// Returns whether two adjacent cells are mutually passable
+//----------------------------------------------------------------------------
+bool PathHierarchy::connected(const sf::Vector2i& a, const sf::Vector2i& b) const
+{
+    sf::Vector2f from(a.x, a.y), to(b.x, b.y);
+
+    return passable(from, to) && passable(to, from);
+}
+
+//----------------------------------------------------------------------------
+// - Flood Cluster (private)
+//----------------------------------------------------------------------------
+// * bounds : cluster region the search is confined to
+// * origin : cell from which distances are measured
+// * reverse : measures distances toward the origin rather than away from it
+// Fills distance_ with breadth-first distances local to bounds, -1 marking
+// unreachable cells
+//----------------------------------------------------------------------------
+void PathHierarchy::flood(const sf::IntRect& bounds, const sf::Vector2i& origin, bool reverse) const
+{
+    const sf::Vector2i offsets[4] = {sf::Vector2i(1, 0), sf::Vector2i(-1, 0), sf::Vector2i(0, 1), sf::Vector2i(0, -1)};
+    int head = 0, tail = 0;
+
+    std::fill(distance_.begin(), distance_.begin() + bounds.width * bounds.height, -1);
+
+    distance_[(origin.x - bounds.left) + (origin.y - bounds.top) * bounds.width] = 0;
+    queue_[tail++] = (origin.x - bounds.left) + (origin.y - bounds.top) * bounds.width;
+
+    while(head < tail)
+    {
+        int local = queue_[head++];
+        sf::Vector2f cell(bounds.left + local % bounds.width, bounds.top + local / bounds.width);
+
+        for(int o = 0; o < 4; o++)
+        {
+            sf::Vector2f adjacent(cell.x + offsets[o].x, cell.y + offsets[o].y);
+            int ax = adjacent.x - bounds.left;
+            int ay = adjacent.y - bounds.top;
+
+            if(ax < 0 || ay < 0 || ax >= bounds.width || ay >= bounds.height)
+            {
+                continue;
+            }
+
+            int next = ax + ay * bounds.width;
+            if(distance_[next] < 0 && (reverse ? passable(adjacent, cell) : passable(cell, adjacent)))
+            {
+                distance_[next] = distance_[local] + 1;
+                queue_[tail++] = next;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Refine Path Segment (private)
+//----------------------------------------------------------------------------
+// * bounds : cluster region the search is confined to
+// * from : first cell of the segment (excluded from the output)
+// * to : last cell of the segment
+// * passable : per-cell passability rule
+// * path : deque which the segment's cells are appended to
+// Returns whether the segment could be traversed within the cluster
+//----------------------------------------------------------------------------
+bool PathHierarchy::refine(const sf::IntRect& bounds, const sf::Vector2i& from, const sf::Vector2i& to, const Passability& passable, std::deque<sf::Vector2f>& path) const
+{
+    const sf::Vector2i offsets[4] = {sf::Vector2i(1, 0), sf::Vector2i(-1, 0), sf::Vector2i(0, 1), sf::Vector2i(0, -1)};
+    int head = 0, tail = 0;
+    int source = (from.x - bounds.left) + (from.y - bounds.top) * bounds.width;
+    int target = (to.x - bounds.left) + (to.y - bounds.top) * bounds.width;
+
+    std::fill(parent_.begin(), parent_.begin() + bounds.width * bounds.height, -2);
+
+    parent_[source] = -1;
+    queue_[tail++] = source;
+
+    while(head < tail && parent_[target] == -2)
+    {
+        int local = queue_[head++];
+        sf::Vector2f cell(bounds.left + local % bounds.width, bounds.top + local / bounds.width);
+
+        for(int o = 0; o < 4; o++)
+        {
+            sf::Vector2f adjacent(cell.x + offsets[o].x, cell.y + offsets[o].y);
+            int ax = adjacent.x - bounds.left;
+            int ay = adjacent.y - bounds.top;
+
+            if(ax < 0 || ay < 0 || ax >= bounds.width || ay >= bounds.height)
+            {
+                continue;
+            }
+
+            int next = ax + ay * bounds.width;
+            if(parent_[next] == -2 && passable(cell, adjacent))
+            {
+                parent_[next] = local;
+                queue_[tail++] = next;
+            }
+        }
+    }
+
+    if(parent_[target] == -2)
+    {
+        return false;
+    }
+
+    // Trace backward, then append in travel order
+    int end = path.size();
+    for(int local = target; local != source; local = parent_[local])
+    {
+        path.insert(path.begin() + end, sf::Vector2f(bounds.left + local % bounds.width, bounds.top + local / bounds.width));
+    }
+
+    return true;
+}
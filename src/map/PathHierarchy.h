@@ -0,0 +1,98 @@
+#ifndef TACTICS_PATH_HIERARCHY_H
+#define TACTICS_PATH_HIERARCHY_H
+
+#include <SFML/Graphics.hpp>
+#include <deque>
+#include <vector>
+#include <functional>
+
+class Map;
+
+// Weight of the distance estimate in the abstract search; above 1, queries
+// expand far fewer entrances in exchange for slightly longer paths
+static const float PATH_GREED = 1.25;
+
+//================================================================================
+// ** PathHierarchy
+//================================================================================
+// Hierarchical (HPA*) path planner over a map. The map is split into square
+// clusters whose shared borders are scanned for entrances; an abstract graph of
+// entrances and their intra-cluster distances is searched first, then refined
+// cell-by-cell inside each cluster. Clusters are rebuilt lazily when alerted of
+// map edits, relinking only their neighborhood. Queries reuse the planner's
+// search buffers, so a planner must not be searched from two threads at once
+//================================================================================
+class PathHierarchy
+{
+// Methods
+public:
+    typedef std::function<bool(const sf::Vector2f&, const sf::Vector2f&)> Passability;
+
+    PathHierarchy(const Map* map, int movementClass = 0, int clusterSize = 16);
+    virtual ~PathHierarchy();
+
+    std::deque<sf::Vector2f>    findPath(const sf::Vector2f& source, const sf::Vector2f& destination, const Passability& passable = Passability()) const;
+    void                        alert(int x, int y);
+    int                         getClusterSize() const;
+    int                         getMovementClass() const;
+    void                        refresh() const;
+
+protected:
+    virtual bool                passable(const sf::Vector2f& from, const sf::Vector2f& to) const;
+
+private:
+    // Cluster Sub-structure
+    struct Cluster
+    {
+        sf::IntRect                 bounds;
+        std::vector<sf::Vector2i>   entrances;
+        std::vector<int>            distances;
+        std::vector<int>            links;
+        int                         first;
+        bool                        dirty;
+    };
+
+    // Search Record Sub-structure
+    struct Record
+    {
+        int                         cost;
+        int                         parent;
+        int                         search;
+        bool                        closed;
+    };
+
+    int                         clusterAt(int x, int y) const;
+    int                         entranceIndex(const Cluster& cluster, const sf::Vector2i& cell) const;
+    void                        scanBorder(int cluster, bool east) const;
+    void                        rebuild(int cluster) const;
+    void                        link(int cluster) const;
+    void                        label() const;
+    int                         find(int label) const;
+    void                        unite(int a, int b) const;
+    bool                        connected(const sf::Vector2i& a, const sf::Vector2i& b) const;
+    void                        flood(const sf::IntRect& bounds, const sf::Vector2i& origin, bool reverse) const;
+    bool                        refine(const sf::IntRect& bounds, const sf::Vector2i& from, const sf::Vector2i& to, const Passability& passable, std::deque<sf::Vector2f>& path) const;
+
+// Members
+    const Map*                  map_;
+    int                         movementClass_;
+    int                         clusterSize_;
+    int                         columns_;
+    int                         rows_;
+    int                         stride_;
+    mutable bool                dirty_;
+    mutable std::vector<int>                        edited_;
+    mutable std::vector<Cluster>                    clusters_;
+    mutable std::vector<std::vector<sf::Vector2i>>  eastBorders_;
+    mutable std::vector<std::vector<sf::Vector2i>>  southBorders_;
+    mutable std::vector<sf::Vector2i>               nodes_;
+    mutable std::vector<int>                        components_;
+    mutable std::vector<int>                        labels_;
+    mutable std::vector<Record>                     records_;
+    mutable int                 searches_;
+    mutable std::vector<int>    distance_;
+    mutable std::vector<int>    parent_;
+    mutable std::vector<int>    queue_;
+};
+
+#endif
\ No newline at end of file
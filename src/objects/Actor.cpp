@@ -1,5 +1,6 @@
 #include "Actor.h"
 #include "../player/skill/SkillAttack.h"
+#include "../game/RedrawTracker.h"
 #include <math.h>
 #include <queue>
 
@@ -8,35 +9,36 @@
 //----------------------------------------------------------------------------
 // - Actor Constructor
 //----------------------------------------------------------------------------
-// * texture : bitmap for this actor's directed sprite animations
+// * texture : bitmap, or region of one, for this actor's directed sprite
+//      animations
 //----------------------------------------------------------------------------
-Actor::Actor(const sf::Texture& texture, const Map* ground) :
+Actor::Actor(const TextureRegion& texture, const Map* ground) :
     MobileObject(ground),
     sprite_(0),
     baseSprite_(new SpriteDirected(texture, 48, 48)),
+    sparks_(new ParticleEmitter(ACTOR_SPARKS)),
     portrait_(0),
     name_("Combatant"),
-    attrMove_(4)
+    attrMove_(4),
+    team_(0),
+    movementClass_(0)
 {
     baseSprite_->setOrigin(24, 39);
     baseSprite_->setPosition(0, 0);
 
+    addClips();
     sprite_ = new SpriteAnimated(baseSprite_);
     sprite_->setFPS(10);
-    std::vector<int> defaultSequence(8), moveSequence(8), attackSequence(8);
-
-    for(int i = 0; i < 8; i++)
-    {
-        defaultSequence[i] = i / 2;
-        moveSequence[i] = i % 4;
-        attackSequence[i] = i + 4;
-    }
-
-    sprite_->add("default", defaultSequence);
-    sprite_->add("walk", moveSequence);
-    sprite_->add("attack", attackSequence);
     sprite_->play("default", true);
 
+    // Hot sparks flung up-ward, falling back as they cool
+    sparks_->setDirection(90, 150);
+    sparks_->setSpeed(60, 140);
+    sparks_->setLifetime(0.2, 0.45);
+    sparks_->setGravity(400);
+    sparks_->setDrag(0.9);
+    sparks_->setColors(sf::Color(255, 240, 160), sf::Color(255, 120, 40, 0));
+
     skills_.push_back(new SkillAttack(*this));
 }
 
@@ -46,6 +48,7 @@ Actor::Actor(const sf::Texture& texture, const Map* ground) :
 Actor::~Actor()
 {
     delete sprite_;
+    delete sparks_;
     if(portrait_)
     {
         delete portrait_;
@@ -89,6 +92,13 @@ void Actor::walkTo(const sf::Vector2f& position)
 //----------------------------------------------------------------------------
 void Actor::walkAlong(const std::deque<sf::Vector2f>& path)
 {
+    // Nowhere to go, so the walk is already over
+    if(path.empty())
+    {
+        walked_.emit();
+        return;
+    }
+
     path_ = path;
     walkTo(path_.front());    
     path_.pop_front();
@@ -109,8 +119,26 @@ bool Actor::walking() const
 //----------------------------------------------------------------------------
 void Actor::stopWalking()
 {
+    bool walking = this->walking();
+
     stopMoving();
     path_.clear();
+
+    if(walking)
+    {
+        walked_.emit();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Walk Signal
+//----------------------------------------------------------------------------
+// Returns the signal emitted when the actor reaches the end of its path, or
+// stops walking
+//----------------------------------------------------------------------------
+Signal& Actor::walked()
+{
+    return walked_;
 }
 
 //----------------------------------------------------------------------------
@@ -121,14 +149,33 @@ struct BFSToken{
     int distance;
 };
 
+//----------------------------------------------------------------------------
+// - Within Search Window?
+//----------------------------------------------------------------------------
+// * position : map position about to be visited
+// * origin : map position of the search window's top-left corner
+// * width : width and length of the square search window
+//----------------------------------------------------------------------------
+static bool withinWindow(const sf::Vector2f& position, const sf::Vector2f& origin, int width)
+{
+    return position.x >= origin.x && position.x < origin.x + width
+        && position.y >= origin.y && position.y < origin.y + width;
+}
+
 //----------------------------------------------------------------------------
 // - Compute Reach
 //----------------------------------------------------------------------------
-// Returns a vector of all reachable positions by this unit's movement using
-// breadth-first search guided by passability laws
+// Returns a vector of all reachable positions by this unit's movement. Under
+// the standard rules, the map's packed terrain grid is flood-filled directly;
+// otherwise, breadth-first search is guided by passability laws
 //----------------------------------------------------------------------------
 std::vector<sf::Vector2f> Actor::reach() const
 {
+    if(ground_ && standardRules())
+    {
+        return reach(ground_->getEntries(movementClass_), ground_->getOccupancy()).positions();
+    }
+
     std::vector<sf::Vector2f> area;
     sf::Vector2f origin = sf::Vector2f(position().x, position().y) - sf::Vector2f(attrMove_, attrMove_);
     int width = 2 * attrMove_ + 1;
@@ -160,7 +207,7 @@ std::vector<sf::Vector2f> Actor::reach() const
             // Check Rightward Position
             adjacent.x = token.position.x + 1;
             adjacent.y = token.position.y;
-            if((adjacent.x >= 0 && adjacent.y >= 0))
+            if(withinWindow(adjacent, origin, width))
             {
                 if(!visited[v_i + 1] && passable(token.position, adjacent)){
                     visited[v_i + 1] = true;
@@ -171,7 +218,7 @@ std::vector<sf::Vector2f> Actor::reach() const
             // Check Leftward Position
             adjacent.x = token.position.x - 1;
             adjacent.y = token.position.y;
-            if((adjacent.x >= 0 && adjacent.y >= 0))
+            if(withinWindow(adjacent, origin, width))
             {
                 if(!visited[v_i - 1] && passable(token.position, adjacent)){
                     visited[v_i - 1] = true;
@@ -182,6 +229,7 @@ std::vector<sf::Vector2f> Actor::reach() const
             // Check Downward Position
             adjacent.x = token.position.x;
             adjacent.y = token.position.y + 1;
+            if(withinWindow(adjacent, origin, width))
             {
                 if(!visited[v_i + width] && passable(token.position, adjacent)){
                     visited[v_i + width] = true;
@@ -192,7 +240,7 @@ std::vector<sf::Vector2f> Actor::reach() const
             // Check Upward Position
             adjacent.x = token.position.x;
             adjacent.y = token.position.y - 1;
-            if((adjacent.x >= 0 && adjacent.y >= 0))
+            if(withinWindow(adjacent, origin, width))
             {
                 if(!visited[v_i - width] && passable(token.position, adjacent)){
                     visited[v_i - width] = true;
@@ -205,6 +253,26 @@ std::vector<sf::Vector2f> Actor::reach() const
     return area;
 }
 
+//----------------------------------------------------------------------------
+// - Compute Reach Grid
+//----------------------------------------------------------------------------
+// * entries : the four grids of positions enterable by a step toward +x, +y,
+//      -x and -y for this actor's movement class
+// * occupancy : grid of positions occupied by a player
+// Returns the grid of reachable positions under the standard rules. Only the
+// given grids and this actor's position are read, so snapshots of the map may
+// be used from any thread
+//----------------------------------------------------------------------------
+BitGrid Actor::reach(const BitGrid* entries, const BitGrid& occupancy) const
+{
+    sf::Vector2i source(round(position().x), round(position().y));
+    BitGrid reached = BitGrid::flood(entries[0], entries[1], entries[2], entries[3], source, attrMove_);
+
+    reached.mask(occupancy, true);
+
+    return reached;
+}
+
 //----------------------------------------------------------------------------
 // - Structure for BFS Search during shortest path computation
 //----------------------------------------------------------------------------
@@ -266,7 +334,7 @@ std::deque<sf::Vector2f> Actor::shortestPath(const sf::Vector2f& destination) co
                 // Check Rightward Position
                 adjacent.x = token.position.x + 1;
                 adjacent.y = token.position.y;
-                if((adjacent.x >= 0 && adjacent.y >= 0))
+                if(withinWindow(adjacent, origin, width))
                 {
                     if(!visited[v_i + 1].visited && passable(token.position, adjacent)){
                         visited[v_i + 1] = {true, v_i, adjacent};
@@ -277,7 +345,7 @@ std::deque<sf::Vector2f> Actor::shortestPath(const sf::Vector2f& destination) co
                 // Check Leftward Position
                 adjacent.x = token.position.x - 1;
                 adjacent.y = token.position.y;
-                if((adjacent.x >= 0 && adjacent.y >= 0))
+                if(withinWindow(adjacent, origin, width))
                 {
                     if(!visited[v_i - 1].visited && passable(token.position, adjacent)){
                         visited[v_i - 1] = {true, v_i, adjacent};
@@ -288,6 +356,7 @@ std::deque<sf::Vector2f> Actor::shortestPath(const sf::Vector2f& destination) co
                 // Check Downward Position
                 adjacent.x = token.position.x;
                 adjacent.y = token.position.y + 1;
+                if(withinWindow(adjacent, origin, width))
                 {
                     if(!visited[v_i + width].visited && passable(token.position, adjacent)){
                         visited[v_i + width] = {true, v_i, adjacent};
@@ -298,7 +367,7 @@ std::deque<sf::Vector2f> Actor::shortestPath(const sf::Vector2f& destination) co
                 // Check Upward Position
                 adjacent.x = token.position.x;
                 adjacent.y = token.position.y - 1;
-                if((adjacent.x >= 0 && adjacent.y >= 0))
+                if(withinWindow(adjacent, origin, width))
                 {
                     if(!visited[v_i - width].visited && passable(token.position, adjacent)){
                         visited[v_i - width] = {true, v_i, adjacent};
@@ -319,6 +388,28 @@ std::deque<sf::Vector2f> Actor::shortestPath(const sf::Vector2f& destination) co
     return path;
 }
 
+//----------------------------------------------------------------------------
+// - Plan Path
+//----------------------------------------------------------------------------
+// * destination : position to plan a path toward, at any distance
+// Returns the path found by the map's hierarchical planner, refined with this
+// actor's passability rules, or an empty deque if there is none. Unlike
+// shortestPath, the search is not bounded by the actor's move range and the
+// path is near-optimal rather than shortest
+//----------------------------------------------------------------------------
+std::deque<sf::Vector2f> Actor::plan(const sf::Vector2f& destination) const
+{
+    if(ground_ == 0)
+    {
+        return std::deque<sf::Vector2f>();
+    }
+
+    sf::Vector2f source(position().x, position().y);
+
+    return ground_->getPathHierarchy(movementClass_).findPath(source, destination,
+        [this](const sf::Vector2f& from, const sf::Vector2f& to){return passable(from, to);});
+}
+
 //----------------------------------------------------------------------------
 // - Get Height (Override)
 //----------------------------------------------------------------------------
@@ -339,14 +430,27 @@ sf::FloatRect Actor::getGlobalBounds() const
     return sprite_->getGlobalBounds();        
 }
 
+//----------------------------------------------------------------------------
+// - Join Buffer (Override)
+//----------------------------------------------------------------------------
+// * buffer : isometric container to add the actor and its sparks to
+//----------------------------------------------------------------------------
+void Actor::join(IsometricBuffer* buffer) const
+{
+    buffer->insert(this);
+    buffer->insert(sparks_);
+}
+
 //----------------------------------------------------------------------------
 // - Set Texture
 //----------------------------------------------------------------------------
-// * texture : bitmap for this actor's directed sprite animations
+// * texture : bitmap, or region of one, for this actor's directed sprite
+//      animations
 //----------------------------------------------------------------------------
-void Actor::setTexture(const sf::Texture& texture)
+void Actor::setTexture(const TextureRegion& texture)
 {
     baseSprite_->setTexture(texture);
+    addClips();
 }
 
 //----------------------------------------------------------------------------
@@ -365,6 +469,17 @@ const SpriteAnimated* Actor::getSprite() const
     return sprite_;
 }
 
+//----------------------------------------------------------------------------
+// - Get Sparks
+//----------------------------------------------------------------------------
+// Returns the emitter of sparks flying off this actor when struck, placed by
+// whoever strikes it
+//----------------------------------------------------------------------------
+ParticleEmitter* Actor::getSparks()
+{
+    return sparks_;
+}
+
 //----------------------------------------------------------------------------
 // - Set Facing
 //----------------------------------------------------------------------------
@@ -422,16 +537,17 @@ sf::Sprite* Actor::getPortrait() const
 //----------------------------------------------------------------------------
 // - Set Portrait Image
 //----------------------------------------------------------------------------
-// * portrait : bitmap to use for the portrait sprite
+// * portrait : bitmap, or region of one, to use for the portrait sprite
 //----------------------------------------------------------------------------
-void Actor::setPortrait(const sf::Texture& portrait)
+void Actor::setPortrait(const TextureRegion& portrait)
 {
     if(portrait_ == 0)
     {
         portrait_ = new sf::Sprite;
     }
 
-    portrait_->setTexture(portrait);
+    portrait_->setTexture(*portrait.getTexture());
+    portrait_->setTextureRect(portrait.getRect());
     portrait_->setScale(64.f / portrait.getSize().x, 104.f / portrait.getSize().y);
 }
 
@@ -474,6 +590,49 @@ void Actor::setMove(int mv)
     }
 }
 
+//----------------------------------------------------------------------------
+// - Get Team
+//----------------------------------------------------------------------------
+int Actor::getTeam() const
+{
+    return team_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Team
+//----------------------------------------------------------------------------
+// * team : index of the side this actor fights for, counting from 0
+//----------------------------------------------------------------------------
+void Actor::setTeam(int team)
+{
+    if(team >= 0)
+    {
+        team_ = team;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Movement Class
+//----------------------------------------------------------------------------
+int Actor::getMovementClass() const
+{
+    return movementClass_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Movement Class
+//----------------------------------------------------------------------------
+// * movementClass : index of the map movement class this actor travels by,
+//      limiting the heights it can climb
+//----------------------------------------------------------------------------
+void Actor::setMovementClass(int movementClass)
+{
+    if(movementClass >= 0)
+    {
+        movementClass_ = movementClass;
+    }
+}
+
 //----------------------------------------------------------------------------
 // - Get Learned Skills
 //----------------------------------------------------------------------------
@@ -491,6 +650,7 @@ const std::vector<Skill*>& Actor::getSkills() const
 void Actor::focus()
 {
     baseSprite_->setColor(sf::Color(255, 150, 150));
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -499,6 +659,7 @@ void Actor::focus()
 void Actor::unfocus()
 {
     baseSprite_->setColor(sf::Color::White);
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -517,13 +678,47 @@ void Actor::draw(sf::RenderTarget& target, sf::RenderStates states) const
 void Actor::step()
 {
     // Update path-based movement
+    bool moving = arrival_ > 0;
     MobileObject::step();
 
     if(arrival_ == 0 && !path_.empty())
     {
         walkTo(path_.front());
         path_.pop_front();
-    }    
+    }
+    else if(moving && arrival_ == 0)
+    {
+        walked_.emit();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Add Animation Clips (protected)
+//----------------------------------------------------------------------------
+// Defines the actor animations on the sheet of its directed sprite, once for
+// all actors sharing the sheet
+//----------------------------------------------------------------------------
+void Actor::addClips()
+{
+    SpriteSheet& sheet = baseSprite_->getSheet();
+
+    if(sheet.getClip("attack"))
+    {
+        return;
+    }
+
+    std::vector<int> defaultSequence(8), moveSequence(8), attackSequence(8);
+
+    for(int i = 0; i < 8; i++)
+    {
+        defaultSequence[i] = i / 2;
+        moveSequence[i] = i % 4;
+        attackSequence[i] = i + 4;
+    }
+
+    sheet.addClip("default", defaultSequence);
+    sheet.addClip("walk", moveSequence);
+    sheet.addClip("attack", attackSequence);
 }
 
 //----------------------------------------------------------------------------
@@ -541,6 +736,18 @@ bool Actor::occupiable(const sf::Vector2f& position) const
     return true;
 }
 
+//----------------------------------------------------------------------------
+// - Standard Rules?
+//----------------------------------------------------------------------------
+// Returns whether this actor's passable and occupiable laws are the standard
+// ones, allowing reach to use the map's packed grids. Subclasses overriding
+// either law should override this to return false
+//----------------------------------------------------------------------------
+bool Actor::standardRules() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------
 // - Terrain Passable
 //----------------------------------------------------------------------------
@@ -552,7 +759,7 @@ bool Actor::passable(const sf::Vector2f& initial, const sf::Vector2f& target) co
 {
     if(ground_)
     {
-        return ground_->valid(target.x, target.y);
+        return ground_->passable(initial, target, movementClass_);
     }
 
     return true;
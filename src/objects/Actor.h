@@ -2,11 +2,15 @@
 #define TACTICS_ACTOR_H
 
 #include "MobileObject.h"
+#include "ParticleEmitter.h"
 #include "../sprite/SpriteAnimated.h"
 #include "../sprite/SpriteDirected.h"
 #include "../player/skill/Skill.h"
 #include <deque>
 
+// Largest number of sparks flying off an actor at once
+static const int ACTOR_SPARKS = 128;
+
 //================================================================================
 // ** Actor
 //================================================================================
@@ -17,7 +21,7 @@ class Actor : public MobileObject
 {
 // Methods
 public:
-    Actor(const sf::Texture& texture, const Map* ground = 0);
+    Actor(const TextureRegion& texture, const Map* ground = 0);
     virtual ~Actor();
 
     void                        walk(const sf::Vector2f& distance);
@@ -25,40 +29,55 @@ public:
     void                        walkAlong(const std::deque<sf::Vector2f>& path);
     bool                        walking() const;
     void                        stopWalking();
+    Signal&                     walked();
     std::vector<sf::Vector2f>   reach() const;
+    BitGrid                     reach(const BitGrid* entries, const BitGrid& occupancy) const;
     std::deque<sf::Vector2f>    shortestPath(const sf::Vector2f& destination) const;
+    std::deque<sf::Vector2f>    plan(const sf::Vector2f& destination) const;
     virtual float               getHeight(const sf::Vector2f& position = sf::Vector2f(0, 0)) const;
     virtual sf::FloatRect       getGlobalBounds() const;
-    void                        setTexture(const sf::Texture& sprite);
+    virtual void                join(IsometricBuffer* buffer) const;
+    void                        setTexture(const TextureRegion& sprite);
     SpriteAnimated*             getSprite();
     const SpriteAnimated*       getSprite() const;
+    ParticleEmitter*            getSparks();
     void                        face(int direction);
     void                        face(const sf::Vector2f& target);
     int                         facing() const;
     const Map*                  getEnvironment() const;
     sf::Sprite*                 getPortrait() const;
-    void                        setPortrait(const sf::Texture& portrait);
+    void                        setPortrait(const TextureRegion& portrait);
     const std::string&          getName() const; 
     void                        setName(const std::string& name);
     int                         getMove() const;
     void                        setMove(int mv);
+    int                         getTeam() const;
+    void                        setTeam(int team);
+    int                         getMovementClass() const;
+    void                        setMovementClass(int movementClass);
     const std::vector<Skill*>&  getSkills() const;
     void                        focus();
     void                        unfocus();
+    virtual bool                standardRules() const;
     
 protected:
     virtual void                draw(sf::RenderTarget& target, sf::RenderStates states) const;
     virtual void                step();
+    void                        addClips();
     virtual bool                occupiable(const sf::Vector2f& position) const;
     virtual bool                passable(const sf::Vector2f& from, const sf::Vector2f& to) const;    
     
 // Members
     SpriteAnimated*             sprite_;
     SpriteDirected*             baseSprite_;
+    ParticleEmitter*            sparks_;
     std::deque<sf::Vector2f>    path_;
+    Signal                      walked_;
     sf::Sprite*                 portrait_;
     std::string                 name_;
     int                         attrMove_;
+    int                         team_;
+    int                         movementClass_;
     std::vector<Skill*>         skills_;
 };
 
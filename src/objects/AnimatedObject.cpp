@@ -7,9 +7,11 @@
 //----------------------------------------------------------------------------
 AnimatedObject::AnimatedObject(float fps) :
     fps_(fps > 0 ? fps : FPS),
-    clock_(0),
     frozen_(false),
-    animHandler_(0)
+    animBucket_(0),
+    animIndex_(-1),
+    sleepy_(false),
+    concurrent_(false)
 {
     Animations::instance().add(this);
 }
@@ -19,10 +21,7 @@ AnimatedObject::AnimatedObject(float fps) :
 //----------------------------------------------------------------------------
 AnimatedObject::~AnimatedObject()
 {
-    if(animHandler_)
-    {
-        delete animHandler_;
-    }
+    Animations::instance().remove(this);
 }
 
 //----------------------------------------------------------------------------
@@ -41,9 +40,24 @@ float AnimatedObject::getFPS() const
 void AnimatedObject::setFPS(float fps)
 {
     // An fps of zero or less is undefined
-    if(fps > 0)
+    if(fps > 0 && fps != fps_)
     {
+        // Move to the bucket matching the new rate, still asleep if it was
+        bool registered = animIndex_ >= 0;
+        bool sleeping = registered && !awake();
+
+        Animations::instance().remove(this);
         fps_ = fps;
+
+        if(registered)
+        {
+            Animations::instance().add(this);
+        }
+
+        if(sleeping)
+        {
+            sleep();
+        }
     }
 }
 
@@ -82,19 +96,49 @@ void AnimatedObject::unfreeze()
 }
 
 //----------------------------------------------------------------------------
-// - Update
+// - Wake Object
 //----------------------------------------------------------------------------
-// * elapsed : relative time passed since last update
+// Resumes calls to step() from the next update of the animations manager
 //----------------------------------------------------------------------------
-void AnimatedObject::update(float elapsed)
+void AnimatedObject::wake()
 {
-    if(!frozen_)
-    {
-        clock_ += elapsed * fps_;
-        while(clock_ >= 1)
-        {
-            step();
-            clock_ -= 1;
-        }
-    }
+    Animations::instance().wake(this);
+}
+
+//----------------------------------------------------------------------------
+// - Is Object Awake?
+//----------------------------------------------------------------------------
+bool AnimatedObject::awake() const
+{
+    return Animations::instance().awake(this);
+}
+
+//----------------------------------------------------------------------------
+// - Put Object to Sleep (protected)
+//----------------------------------------------------------------------------
+// Suspends calls to step() until woken. Called by objects once they have no
+// work left, so they cost nothing per frame while idle
+//----------------------------------------------------------------------------
+void AnimatedObject::sleep()
+{
+    Animations::instance().sleep(this);
+}
+
+//----------------------------------------------------------------------------
+// - Is Object Concurrent?
+//----------------------------------------------------------------------------
+bool AnimatedObject::concurrent() const
+{
+    return concurrent_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Concurrent Status (protected)
+//----------------------------------------------------------------------------
+// * concurrent : declares that step() only touches this object's own state,
+//      besides sleep(), so it may run in parallel with other such objects
+//----------------------------------------------------------------------------
+void AnimatedObject::setConcurrent(bool concurrent)
+{
+    concurrent_ = concurrent;
 }
\ No newline at end of file
@@ -8,8 +8,11 @@
 // ** AnimatedObject
 //================================================================================
 // Represents an abstract object animated in relative time, calling a step()
-// method per frame based on a relative (mutable) FPS rate
-// update() progresses this relative time
+// method per frame based on a relative (mutable) FPS rate. Time is kept by the
+// Animations manager, shared among all objects of the same rate. Idle objects
+// put themselves to sleep, and are woken by whichever call gives them work.
+// Objects whose step() only touches their own state may declare themselves
+// concurrent, to be stepped in parallel with one another
 //================================================================================
 class AnimatedObject
 {
@@ -24,20 +27,26 @@ public:
     void            setFrozen(bool frozen);
     void            freeze();
     void            unfreeze();
-    void            update(float elapsed);
+    void            wake();
+    bool            awake() const;
+    bool            concurrent() const;
 
-    friend class Animations::Node;
+    friend class Animations;
 
 protected:
     virtual void    step() = 0;
+    void            sleep();
+    void            setConcurrent(bool concurrent);
 
 // Members
     float           fps_;
-    float           clock_;
     bool            frozen_;
 
 private:
-    Animations::Node* animHandler_; 
+    int             animBucket_;
+    int             animIndex_;
+    bool            sleepy_;
+    bool            concurrent_;
 };
 
 #endif
\ No newline at end of file
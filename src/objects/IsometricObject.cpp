@@ -1,6 +1,7 @@
 #include "IsometricObject.h"
 #include "../map/IsometricNode.h"
 #include "../map/IsometricBuffer.h"
+#include "../game/RedrawTracker.h"
 #include "../settings.h"
 
 //----------------------------------------------------------------------------
@@ -58,6 +59,7 @@ void IsometricObject::setPosition(const sf::Vector3f& position)
     {
         // Alert handler of change
         handler_->alert(); 
+        RedrawTracker::instance().request();
     }
 }
 
@@ -40,6 +40,7 @@ void MobileObject::moveTo(const sf::Vector3f& position)
 {
     destination_ = position;
     arrival_ = computeArrival(position);
+    wake();
 }
 
 //----------------------------------------------------------------------------
@@ -56,6 +57,7 @@ void MobileObject::moveTo(const sf::Vector3f& position, float duration)
     {        
         destination_ = position;
         arrival_ = int(duration * getFPS() / speed_);
+        wake();
     }
 }
 
@@ -99,6 +101,16 @@ void MobileObject::setSpeed(float speed)
     }
 }
 
+//----------------------------------------------------------------------------
+// - Get Arrival Signal
+//----------------------------------------------------------------------------
+// Returns the signal emitted when the object reaches its destination
+//----------------------------------------------------------------------------
+Signal& MobileObject::arrived()
+{
+    return arrived_;
+}
+
 //----------------------------------------------------------------------------
 // - Increment Frame
 //----------------------------------------------------------------------------
@@ -118,7 +130,17 @@ void MobileObject::step()
         }
 
         setPosition(sf::Vector3f(x, y, z));
-        arrival_--;
+
+        if(--arrival_ == 0)
+        {
+            arrived_.emit();
+        }
+    }
+
+    // Idle until given a new destination
+    if(arrival_ <= 0)
+    {
+        sleep();
     }
 }
 
@@ -4,11 +4,13 @@
 #include "IsometricObject.h"
 #include "AnimatedObject.h"
 #include "../map/Map.h"
+#include "../game/Signal.h"
  
 //================================================================================
 // ** MobileObject
 //================================================================================
-// Represents an isometric object which moves per-pixel through relative time
+// Represents an isometric object which moves per-pixel through relative time,
+// signaling each arrival at its destination
 //================================================================================
 class MobileObject : public IsometricObject, public AnimatedObject
 {
@@ -24,6 +26,7 @@ public:
     void            stopMoving();
     float           getSpeed() const;
     void            setSpeed(float speed);
+    Signal&         arrived();
 
 protected:
     virtual void    step();
@@ -34,6 +37,7 @@ protected:
     int             arrival_;
     sf::Vector3f    destination_;
     float           speed_;
+    Signal          arrived_;
 };
 
 #endif
\ No newline at end of file
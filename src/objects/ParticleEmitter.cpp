@@ -0,0 +1,349 @@
+#include "ParticleEmitter.h"
+#include "../game/DrawList.h"
+#include "../game/RedrawTracker.h"
+#include "../game/Simulation.h"
+#include <algorithm>
+#include <math.h>
+
+# define M_PI 3.14159265358979323846
+
+//----------------------------------------------------------------------------
+// - Particle Emitter Constructor
+//----------------------------------------------------------------------------
+// * capacity : largest number of particles alive at once, allocated up front
+// * seed : seed of the emitter's own random numbers, spreading its particles
+//----------------------------------------------------------------------------
+ParticleEmitter::ParticleEmitter(int capacity, unsigned seed) :
+    IsometricObject(),
+    AnimatedObject(FPS),
+    capacity_(std::max(capacity, 0)),
+    count_(0),
+    x_(capacity_),
+    y_(capacity_),
+    vx_(capacity_),
+    vy_(capacity_),
+    age_(capacity_),
+    aging_(capacity_),
+    vertices_(sf::Quads),
+    origin_(0, 0),
+    direction_(90),
+    spread_(360),
+    minSpeed_(40),
+    maxSpeed_(80),
+    minLifetime_(0.3),
+    maxLifetime_(0.6),
+    gravity_(0),
+    drag_(0),
+    start_(sf::Color::White),
+    end_(sf::Color(255, 255, 255, 0)),
+    size_(2),
+    random_(seed ? seed : 1)
+{
+    // Particles only touch this emitter
+    setConcurrent(true);
+
+    // Grown once to its largest size, so drawing never allocates
+    vertices_.resize(capacity_ * 4);
+    vertices_.clear();
+}
+
+//----------------------------------------------------------------------------
+// - Particle Emitter Destructor
+//----------------------------------------------------------------------------
+ParticleEmitter::~ParticleEmitter()
+{
+
+}
+
+//----------------------------------------------------------------------------
+// - Emit Particles
+//----------------------------------------------------------------------------
+// * count : number of particles to spawn at the origin, each with its own
+//      direction, speed and lifetime within the emitter's ranges
+// Returns the number of particles spawned, fewer once the pool is full
+//----------------------------------------------------------------------------
+int ParticleEmitter::emit(int count)
+{
+    if(Simulation::headless())
+    {
+        return 0;
+    }
+
+    int spawned = std::max(0, std::min(count, capacity_ - count_));
+
+    for(int i = count_; i < count_ + spawned; i++)
+    {
+        float angle = (direction_ + random(-spread_ / 2, spread_ / 2)) * M_PI / 180;
+        float speed = random(minSpeed_, maxSpeed_);
+        float lifetime = random(minLifetime_, maxLifetime_);
+
+        x_[i] = origin_.x;
+        y_[i] = origin_.y;
+        vx_[i] = cos(angle) * speed;
+        vy_[i] = -sin(angle) * speed;
+        age_[i] = 0;
+        aging_[i] = lifetime > 0 ? 1 / (lifetime * fps_) : 1;
+    }
+
+    if(spawned > 0)
+    {
+        count_ += spawned;
+        wake();
+    }
+
+    return spawned;
+}
+
+//----------------------------------------------------------------------------
+// - Clear Particles
+//----------------------------------------------------------------------------
+void ParticleEmitter::clear()
+{
+    if(count_ > 0)
+    {
+        count_ = 0;
+        vertices_.clear();
+        RedrawTracker::instance().request();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Live Particle Count
+//----------------------------------------------------------------------------
+int ParticleEmitter::live() const
+{
+    return count_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Particle Capacity
+//----------------------------------------------------------------------------
+int ParticleEmitter::capacity() const
+{
+    return capacity_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Origin
+//----------------------------------------------------------------------------
+// * origin : pixel offset from the emitter's position where particles spawn
+//----------------------------------------------------------------------------
+void ParticleEmitter::setOrigin(const sf::Vector2f& origin)
+{
+    origin_ = origin;
+}
+
+//----------------------------------------------------------------------------
+// - Set Emission Direction
+//----------------------------------------------------------------------------
+// * angle : direction (0 ~ 360 degrees) particles are sent toward, where an
+//      angle of 0 is right-ward and 90 is up-ward on screen
+// * spread : width of the cone (0 ~ 360 degrees) around the direction
+//----------------------------------------------------------------------------
+void ParticleEmitter::setDirection(float angle, float spread)
+{
+    direction_ = angle;
+    spread_ = std::max(0.f, std::min(spread, 360.f));
+}
+
+//----------------------------------------------------------------------------
+// - Set Emission Speed
+//----------------------------------------------------------------------------
+// * min, max : range of the particles' initial speed, in pixels per second
+//----------------------------------------------------------------------------
+void ParticleEmitter::setSpeed(float min, float max)
+{
+    minSpeed_ = std::max(0.f, min);
+    maxSpeed_ = std::max(minSpeed_, max);
+}
+
+//----------------------------------------------------------------------------
+// - Set Particle Lifetime
+//----------------------------------------------------------------------------
+// * min, max : range of the particles' lifetime, in seconds
+//----------------------------------------------------------------------------
+void ParticleEmitter::setLifetime(float min, float max)
+{
+    minLifetime_ = std::max(0.f, min);
+    maxLifetime_ = std::max(minLifetime_, max);
+}
+
+//----------------------------------------------------------------------------
+// - Set Gravity
+//----------------------------------------------------------------------------
+// * gravity : down-ward acceleration of the particles, in pixels per second
+//      squared, or less than 0 for particles rising up
+//----------------------------------------------------------------------------
+void ParticleEmitter::setGravity(float gravity)
+{
+    gravity_ = gravity;
+}
+
+//----------------------------------------------------------------------------
+// - Set Drag
+//----------------------------------------------------------------------------
+// * drag : portion (0 ~ 1) of the particles' velocity lost per second
+//----------------------------------------------------------------------------
+void ParticleEmitter::setDrag(float drag)
+{
+    drag_ = std::max(0.f, std::min(drag, 1.f));
+}
+
+//----------------------------------------------------------------------------
+// - Set Colors
+//----------------------------------------------------------------------------
+// * start : color of newly spawned particles
+// * end : color particles blend toward, reached as they expire
+//----------------------------------------------------------------------------
+void ParticleEmitter::setColors(const sf::Color& start, const sf::Color& end)
+{
+    start_ = start;
+    end_ = end;
+}
+
+//----------------------------------------------------------------------------
+// - Set Particle Size
+//----------------------------------------------------------------------------
+// * size : width and height of each particle's square, in pixels
+//----------------------------------------------------------------------------
+void ParticleEmitter::setSize(float size)
+{
+    size_ = std::max(0.f, size);
+}
+
+//----------------------------------------------------------------------------
+// - Get Height (Override)
+//----------------------------------------------------------------------------
+// * position : (x,y) position relative to the center of the object
+// Particles are flat, leaving the space above the emitter free
+//----------------------------------------------------------------------------
+float ParticleEmitter::getHeight(const sf::Vector2f& position) const
+{
+    return 0;
+}
+
+//----------------------------------------------------------------------------
+// - Get Global Bounding Rectangle (Override)
+//----------------------------------------------------------------------------
+// Returns the farthest any particle may travel from the origin under the
+// emitter's current speed, lifetime and gravity, taken by the depth buffer
+// whenever the emitter moves
+//----------------------------------------------------------------------------
+sf::FloatRect ParticleEmitter::getGlobalBounds() const
+{
+    float reach = maxSpeed_ * maxLifetime_ + 0.5 * fabs(gravity_) * maxLifetime_ * maxLifetime_ + size_;
+
+    return sf::FloatRect(origin_.x - reach, origin_.y - reach, reach * 2, reach * 2);
+}
+
+//----------------------------------------------------------------------------
+// - Draw (Override)
+//----------------------------------------------------------------------------
+void ParticleEmitter::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if(count_ > 0)
+    {
+        DrawList::submit(target, vertices_, states);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Increment Frame
+//----------------------------------------------------------------------------
+// Moves and ages all particles, each attribute in its own loop free of
+// branches so it runs several particles at a time, then drops the expired
+// ones by moving the last live ones into their place. The quads are laid out
+// again last. Sleeps once no particles are left
+//----------------------------------------------------------------------------
+void ParticleEmitter::step()
+{
+    if(count_ == 0)
+    {
+        sleep();
+        return;
+    }
+
+    float dt = 1 / fps_;
+    float keep = pow(1 - drag_, dt);
+    float fall = gravity_ * dt;
+    int n = count_;
+
+    float* x = &x_[0];
+    float* y = &y_[0];
+    float* vx = &vx_[0];
+    float* vy = &vy_[0];
+    float* age = &age_[0];
+    float* aging = &aging_[0];
+
+    for(int i = 0; i < n; i++)
+    {
+        vx[i] *= keep;
+        vy[i] = vy[i] * keep + fall;
+    }
+
+    for(int i = 0; i < n; i++)
+    {
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+        age[i] += aging[i];
+    }
+
+    // Expired particles
+    for(int i = 0; i < n;)
+    {
+        if(age[i] >= 1)
+        {
+            n--;
+            x[i] = x[n];
+            y[i] = y[n];
+            vx[i] = vx[n];
+            vy[i] = vy[n];
+            age[i] = age[n];
+            aging[i] = aging[n];
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    count_ = n;
+
+    // Quads, blending each particle's color by its age
+    float half = size_ / 2;
+    vertices_.resize(n * 4);
+
+    for(int i = 0; i < n; i++)
+    {
+        float t = age[i];
+        sf::Color color(
+            sf::Uint8(start_.r + (end_.r - start_.r) * t),
+            sf::Uint8(start_.g + (end_.g - start_.g) * t),
+            sf::Uint8(start_.b + (end_.b - start_.b) * t),
+            sf::Uint8(start_.a + (end_.a - start_.a) * t));
+
+        sf::Vertex* quad = &vertices_[i * 4];
+        quad[0] = sf::Vertex(sf::Vector2f(x[i] - half, y[i] - half), color);
+        quad[1] = sf::Vertex(sf::Vector2f(x[i] + half, y[i] - half), color);
+        quad[2] = sf::Vertex(sf::Vector2f(x[i] + half, y[i] + half), color);
+        quad[3] = sf::Vertex(sf::Vector2f(x[i] - half, y[i] + half), color);
+    }
+
+    RedrawTracker::instance().request();
+}
+
+//----------------------------------------------------------------------------
+// - Random Number (protected)
+//----------------------------------------------------------------------------
+// * min, max : range of the number returned
+// Draws from the emitter's own xorshift sequence, leaving the game's random
+// numbers as they were
+//----------------------------------------------------------------------------
+float ParticleEmitter::random(float min, float max)
+{
+    random_ ^= random_ << 13;
+    random_ ^= random_ >> 17;
+    random_ ^= random_ << 5;
+
+    return min + (max - min) * (random_ >> 8) / float(1 << 24);
+}
\ No newline at end of file
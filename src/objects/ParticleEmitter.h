@@ -0,0 +1,71 @@
+#ifndef TACTICS_PARTICLE_EMITTER_H
+#define TACTICS_PARTICLE_EMITTER_H
+
+#include "IsometricObject.h"
+#include "AnimatedObject.h"
+#include <vector>
+
+//================================================================================
+// ** ParticleEmitter
+//================================================================================
+// Represents a burst source of short-lived square particles (sparks, dust,
+// spell effects) sitting at a single depth in the isometric buffer. Particles
+// are kept in a fixed-capacity pool as separate arrays of each attribute, so
+// the per-frame motion is a few flat loops the compiler vectorizes, and are
+// drawn together from one vertex array. Particles only move on screen around
+// the emitter, and never touch the game's state or random numbers. Headless
+// simulations emit nothing. Idle emitters sleep
+//================================================================================
+class ParticleEmitter : public IsometricObject, public AnimatedObject
+{
+// Methods
+public:
+    ParticleEmitter(int capacity, unsigned seed = 1);
+    virtual ~ParticleEmitter();
+
+    int                     emit(int count);
+    void                    clear();
+    int                     live() const;
+    int                     capacity() const;
+    void                    setOrigin(const sf::Vector2f& origin);
+    void                    setDirection(float angle, float spread = 360);
+    void                    setSpeed(float min, float max);
+    void                    setLifetime(float min, float max);
+    void                    setGravity(float gravity);
+    void                    setDrag(float drag);
+    void                    setColors(const sf::Color& start, const sf::Color& end);
+    void                    setSize(float size);
+    virtual float           getHeight(const sf::Vector2f& position = sf::Vector2f(0, 0)) const;
+    virtual sf::FloatRect   getGlobalBounds() const;
+
+protected:
+    virtual void            draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    virtual void            step();
+    float                   random(float min, float max);
+
+// Members
+    int                     capacity_;
+    int                     count_;
+    std::vector<float>      x_;
+    std::vector<float>      y_;
+    std::vector<float>      vx_;
+    std::vector<float>      vy_;
+    std::vector<float>      age_;
+    std::vector<float>      aging_;
+    sf::VertexArray         vertices_;
+    sf::Vector2f            origin_;
+    float                   direction_;
+    float                   spread_;
+    float                   minSpeed_;
+    float                   maxSpeed_;
+    float                   minLifetime_;
+    float                   maxLifetime_;
+    float                   gravity_;
+    float                   drag_;
+    sf::Color               start_;
+    sf::Color               end_;
+    float                   size_;
+    unsigned                random_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "game/TextureAtlas.h"
+#include <iostream>
+#include <filesystem>
+
+//================================================================================
+// ** Tactics Atlas Packer
+//================================================================================
+// Offline step packing every png image of a directory into a texture atlas,
+// saved as page images and a region list. Scenes open the saved atlas at
+// startup in place of packing their graphics themselves.
+// Usage: pack [directory] [prefix]
+//================================================================================
+int main(int argc, char** argv)
+{
+    std::string directory = argc > 1 ? argv[1] : "resources/graphics";
+    std::string prefix = argc > 2 ? argv[2] : directory + "/atlas";
+
+    TextureAtlas atlas;
+    int images = 0;
+
+    for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(directory))
+    {
+        std::string filename = entry.path().filename().string();
+
+        // Skip pages of previously saved atlases
+        if(entry.path().extension() != ".png" || filename.rfind(std::filesystem::path(prefix).filename().string() + "_", 0) == 0)
+        {
+            continue;
+        }
+
+        if(!atlas.add(directory + "/" + filename))
+        {
+            std::cout << "Could not load " << filename << std::endl;
+            return 1;
+        }
+
+        images++;
+    }
+
+    int pages = atlas.pack();
+
+    if(!atlas.save(prefix))
+    {
+        std::cout << "Could not save " << prefix << std::endl;
+        return 1;
+    }
+
+    std::cout << images << " images packed into " << pages << " pages" << std::endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -40,6 +40,27 @@ std::string Skill::name() const
     return name_;
 }
 
+//----------------------------------------------------------------------------
+// Get Maximum Range
+//----------------------------------------------------------------------------
+// Returns the farthest (Manhattan) distance from the caster that range() may
+// ever yield, used to estimate threatened areas
+//----------------------------------------------------------------------------
+int Skill::maxRange() const
+{
+    return 0;
+}
+
+//----------------------------------------------------------------------------
+// Get Cast Ended Signal
+//----------------------------------------------------------------------------
+// Returns the signal emitted when the skill finishes being cast
+//----------------------------------------------------------------------------
+Signal& Skill::castEnded()
+{
+    return castEnded_;
+}
+
 //----------------------------------------------------------------------------
 // Set Casting Flag
 //----------------------------------------------------------------------------
@@ -47,7 +68,13 @@ std::string Skill::name() const
 //----------------------------------------------------------------------------
 void Skill::setCastingStatus(bool casting)
 {
+    bool ended = casting_ && !casting;
     casting_ = casting;
+
+    if(ended)
+    {
+        castEnded_.emit();
+    }
 }
 #include <iostream>
 //----------------------------------------------------------------------------
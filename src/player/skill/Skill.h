@@ -4,6 +4,7 @@
 #include<SFML/Graphics.hpp>
 #include<vector>
 #include<string>
+#include "../../game/Signal.h"
 
 class Actor;
 class Map;
@@ -25,9 +26,11 @@ public:
     virtual std::vector<sf::Vector2f>   area(const sf::Vector3f& target) const = 0;
     virtual std::vector<Actor*>         affected(const sf::Vector3f& target) const;
     virtual bool                        effective(const sf::Vector3f& target) const;
+    virtual int                         maxRange() const;
     
     Actor*                              caster();
     bool                                casting() const;
+    Signal&                             castEnded();
     std::string                         name() const;    
 
 protected:
@@ -36,6 +39,7 @@ protected:
 // Members
     Actor*      caster_;
     bool        casting_;
+    Signal      castEnded_;
     std::string name_;
 };
 
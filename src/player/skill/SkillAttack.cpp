@@ -1,7 +1,6 @@
 #include "SkillAttack.h"
 #include "../../objects/Actor.h"
 #include "../../map/Map.h"
-#include "../../game/ActionScheduler.h"
 
 #include <iostream>
 
@@ -21,17 +20,35 @@ SkillAttack::SkillAttack(Actor& caster) :
 //----------------------------------------------------------------------------
 void SkillAttack::use(const std::vector<Actor*>& targets)
 {
-    setCastingStatus(true);
-    
     // Attack the first target with a basic slash
-    caster_->face(sf::Vector2f(targets[0]->position().x, targets[0]->position().y));
+    attack(targets[0]);
+}
+
+//----------------------------------------------------------------------------
+// - Basic Attack Sequence (protected)
+//----------------------------------------------------------------------------
+// * target : actor being slashed
+//----------------------------------------------------------------------------
+Script SkillAttack::attack(Actor* target)
+{
+    setCastingStatus(true);
+
+    caster_->face(sf::Vector2f(target->position().x, target->position().y));
     caster_->getSprite()->play("attack");
 
-    // After the basic attack animation has finished, end the skill sequence
-    ActionScheduler::instance().schedule(Action([this](){
-        caster_->getSprite()->play("default", true);
-        setCastingStatus(false);
-    }, 54));
+    // Sparks fly off the target as the swing lands, at about its chest
+    co_await caster_->getSprite()->finished();
+
+    ParticleEmitter* sparks = target->getSparks();
+    sparks->setPosition(sf::Vector3f(target->position().x, target->position().y, target->position().z + target->getHeight()));
+    sparks->emit(SPARKS_PER_HIT);
+
+    // Shortly after the basic attack animation has finished, end the skill
+    // sequence
+    co_await frames(6);
+
+    caster_->getSprite()->play("default", true);
+    setCastingStatus(false);
 }
 
 //----------------------------------------------------------------------------
@@ -78,3 +95,10 @@ std::vector<sf::Vector2f> SkillAttack::area(const sf::Vector3f& target) const
     return std::vector<sf::Vector2f>(1, sf::Vector2f(target.x, target.y));
 }
 
+//----------------------------------------------------------------------------
+// - Get Basic Attack Maximum Range (Override)
+//----------------------------------------------------------------------------
+int SkillAttack::maxRange() const
+{
+    return 1;
+}
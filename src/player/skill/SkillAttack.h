@@ -2,6 +2,10 @@
 #define TACTICS_SKILL_BASIC_ATTACK_H
 
 #include "Skill.h"
+#include "../../game/Script.h"
+
+// Number of sparks flying off a target struck by a basic attack
+static const int SPARKS_PER_HIT = 24;
 
 //================================================================================
 // ** Skill Attack
@@ -17,6 +21,10 @@ public:
     virtual void use(const std::vector<Actor*>& targets);
     virtual std::vector<sf::Vector2f> range() const;
     virtual std::vector<sf::Vector2f> area(const sf::Vector3f& target) const;
+    virtual int maxRange() const;
+
+protected:
+    Script attack(Actor* target);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "game/Scene.h"
+#include "game/Simulation.h"
+#include "game/InputManager.h"
+#include "control/ScriptedInput.h"
+#include <SFML/OpenGL.hpp>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Drawing phases of a scene, timed separately
+static const int DRAW_PHASES = 6;
+static const char* DRAW_PHASE_NAMES[DRAW_PHASES] = {"background", "map", "foreground", "huds", "menus", "overlays"};
+
+// Largest difference in any color channel still matching a golden image, as
+// software rasterizers may round differently between versions
+static const int GOLDEN_TOLERANCE = 2;
+
+//================================================================================
+// ** ProfiledScene
+//================================================================================
+// Scene drawing each of its phases on demand, so they can be timed apart
+//================================================================================
+class ProfiledScene : public Scene
+{
+public:
+    void drawPhase(int phase, sf::RenderTarget& target) const
+    {
+        if(!active_ || closed_) return;
+
+        switch(phase)
+        {
+            case 0: drawBackground(target, sf::RenderStates::Default); break;
+            case 1: drawMap(target, sf::RenderStates::Default); break;
+            case 2: drawForeground(target, sf::RenderStates::Default); break;
+            case 3: drawHUDs(target, sf::RenderStates::Default); break;
+            case 4: drawMenus(target, sf::RenderStates::Default); break;
+            case 5: drawOverlays(target, sf::RenderStates::Default); break;
+        }
+    }
+};
+
+//----------------------------------------------------------------------------
+// - Compare Against Golden Image
+//----------------------------------------------------------------------------
+// Returns the number of pixels differing from the golden image by more than
+// the tolerance in any channel, or every pixel if the sizes differ
+//----------------------------------------------------------------------------
+unsigned long compare(const sf::Image& frame, const sf::Image& golden)
+{
+    sf::Vector2u size = frame.getSize();
+
+    if(golden.getSize() != size)
+    {
+        return (unsigned long)size.x * size.y;
+    }
+
+    const sf::Uint8* a = frame.getPixelsPtr();
+    const sf::Uint8* b = golden.getPixelsPtr();
+    unsigned long differing = 0;
+
+    for(unsigned long p = 0; p < (unsigned long)size.x * size.y; p++)
+    {
+        for(int c = 0; c < 4; c++)
+        {
+            if(abs(a[p * 4 + c] - b[p * 4 + c]) > GOLDEN_TOLERANCE)
+            {
+                differing++;
+                break;
+            }
+        }
+    }
+
+    return differing;
+}
+
+//================================================================================
+// ** Tactics Offscreen Renderer
+//================================================================================
+// Plays the same seeded game as the headless simulation, but with all graphics
+// loaded, drawing every frame into an offscreen render texture instead of a
+// window. Needs no physical display or GPU: a software GL context, such as
+// Mesa's under a virtual X server, is enough. Each drawing phase is timed
+// apart, up to when the GL has finished it, and reported as a mean and
+// percentiles per frame. Every interval frames, the frame is captured to
+// <directory>/frame_<n>.png, or compared against the golden image there if
+// one exists, writing the differing capture to frame_<n>.actual.png. Goldens
+// are written afresh with --update. Exits non-zero on any mismatch.
+// Usage: render [seed] [frames] [interval] [directory] [--update]
+//================================================================================
+int main(int argc, char** argv)
+{
+    unsigned seed = argc > 1 ? strtoul(argv[1], 0, 10) : 1;
+    unsigned long frames = argc > 2 ? strtoul(argv[2], 0, 10) : 600;
+    unsigned long interval = argc > 3 ? std::max(strtoul(argv[3], 0, 10), 1UL) : 60;
+    std::string directory = argc > 4 ? argv[4] : "";
+    bool update = argc > 5 && std::string(argv[5]) == "--update";
+
+    Simulation simulation(seed, false);
+
+    // Random player, as in the headless simulation
+    static const sf::Keyboard::Key keys[] = {
+        sf::Keyboard::Up, sf::Keyboard::Down, sf::Keyboard::Left, sf::Keyboard::Right,
+        sf::Keyboard::Return, sf::Keyboard::Return, sf::Keyboard::Escape
+    };
+    std::mt19937 random(seed);
+
+    ScriptedInput input;
+    input.setGenerator([&random](){
+        sf::Keyboard::Key key = keys[random() % 7];
+        return key == sf::Keyboard::Escape && InputManager::instance().size() < 2 ? sf::Keyboard::Return : key;
+    });
+    InputManager::instance().setSource(&input);
+
+    sf::RenderTexture target;
+    if(!target.create(ASPECT_RATIO.x, ASPECT_RATIO.y))
+    {
+        std::cout << "Could not create an offscreen render texture" << std::endl;
+        return 1;
+    }
+
+    ProfiledScene scene;
+    scene.start();
+
+    std::vector<double> phaseTimes[DRAW_PHASES];
+    std::vector<double> frameTimes;
+    int captured = 0, written = 0, mismatches = 0;
+
+    for(unsigned long f = 1; f <= frames && !scene.closed(); f++)
+    {
+        simulation.step();
+
+        // Draw calls, each phase timed until the GL has finished it
+        target.setActive(true);
+        glFinish();
+
+        double total = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        target.clear(sf::Color::Black);
+
+        for(int p = 0; p < DRAW_PHASES; p++)
+        {
+            scene.drawPhase(p, target);
+            glFinish();
+
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double, std::micro>(end - start).count();
+
+            phaseTimes[p].push_back(elapsed);
+            total += elapsed;
+            start = end;
+        }
+
+        target.display();
+        frameTimes.push_back(total);
+
+        // Capture
+        if(directory.empty() || f % interval != 0)
+        {
+            continue;
+        }
+
+        std::stringstream path;
+        path << directory << "/frame_" << f;
+
+        sf::Image frame = target.getTexture().copyToImage();
+        sf::Image golden;
+        captured++;
+
+        if(update || !golden.loadFromFile(path.str() + ".png"))
+        {
+            written += frame.saveToFile(path.str() + ".png");
+        }
+        else
+        {
+            unsigned long differing = compare(frame, golden);
+
+            if(differing > 0)
+            {
+                std::cout << "MISMATCH: frame " << f << ", " << differing << " pixels differ" << std::endl;
+                frame.saveToFile(path.str() + ".actual.png");
+                mismatches++;
+            }
+        }
+    }
+
+    InputManager::instance().setSource(0);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Seed " << seed << ": " << frameTimes.size() << " frames drawn, " << scene.turn() << " turns" << std::endl;
+
+    for(int p = 0; p <= DRAW_PHASES; p++)
+    {
+        std::vector<double>& times = p < DRAW_PHASES ? phaseTimes[p] : frameTimes;
+        int n = times.size();
+
+        if(n == 0)
+        {
+            continue;
+        }
+
+        double sum = 0;
+        for(double time : times) sum += time;
+        std::sort(times.begin(), times.end());
+
+        std::cout << "  " << std::left << std::setw(10) << (p < DRAW_PHASES ? DRAW_PHASE_NAMES[p] : "frame") << std::right
+            << " mean " << std::setw(9) << sum / n << " us, p50 " << std::setw(9) << times[n / 2]
+            << " us, p99 " << std::setw(9) << times[n * 99 / 100] << " us" << std::endl;
+    }
+
+    if(!directory.empty())
+    {
+        std::cout << "  " << captured << " captures, " << written << " goldens written, " << mismatches << " mismatches" << std::endl;
+    }
+
+    return mismatches > 0;
+}
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "Panorama.h"
+#include "../game/DrawList.h"
+#include "../game/RedrawTracker.h"
 #include "../settings.h"
 #include <algorithm>
 #include <math.h>
@@ -12,25 +14,22 @@
 // * roi : region-of-interest as a portion  of the texture map (0~1 x 0~1)
 //----------------------------------------------------------------------------
 Panorama::Panorama(const sf::Texture& texture, const sf::Vector2f& roi) :
-    AnimatedObject(FPS),
+    AnimatedObject(PANORAMA_FPS),
+    texture_(0),
     rate_(1),
     direction_(0),
-    panX_(0),
-    panY_(0),
     roi_(sf::Vector2f(1, 1)),
-    image_(sf::Sprite(texture))
+    parallax_(0, 0),
+    camera_(0),
+    color_(sf::Color::White),
+    frame_(0),
+    quad_(sf::Quads, 4)
 {
-    // Panoramic textures must repeat
-    const_cast<sf::Texture&>(texture).setRepeated(true);
-    
-    if(roi.x > 0 && roi.y > 0)
-    {
-        roi_.x = std::min(1.f, roi.x);
-        roi_.y = std::min(1.f, roi.y);
-    }
+    // Panning only touches this panorama
+    setConcurrent(true);
 
-    image_.setTextureRect(sf::IntRect(0, 0, roi_.x * texture.getSize().x, roi_.y * texture.getSize().y));
-    view_ = sf::View(sf::FloatRect(0, 0, texture.getSize().x, texture.getSize().y));
+    setROI(roi);
+    setTexture(texture);
 }
 
 //----------------------------------------------------------------------------
@@ -52,13 +51,15 @@ float Panorama::getPanningRate() const
 //----------------------------------------------------------------------------
 // - Set Panning Rate
 //----------------------------------------------------------------------------
-// * rps : number of times the entire image is panned through in 1 second
+// * rps : number of times the entire image is panned through in 1 second, or
+//      0 for a still layer
 //----------------------------------------------------------------------------
 void Panorama::setPanningRate(float rps)
 {
-    if(rps > 0)
+    if(rps >= 0)
     {
         rate_ = rps;
+        wake();
     }
 }
 
@@ -102,19 +103,72 @@ const sf::Vector2f& Panorama::getROI() const
 //----------------------------------------------------------------------------
 // - Set Region of Interest
 //----------------------------------------------------------------------------
-// * roi : region-of-interest as a portion  of the texture map (0~1 x 0~1)
+// * roi : region-of-interest as a portion of the texture map (0~1 x 0~1)
+//      stretched over the view. Portions over 1 repeat the texture
 //----------------------------------------------------------------------------
 void Panorama::setROI(const sf::Vector2f& roi)
 {
     if(roi.x > 0 && roi.y > 0)
     {
-        roi_.x = std::min(1.f, roi.x);
-        roi_.y = std::min(1.f, roi.y);
+        roi_ = roi;
     }
+}
+
+//----------------------------------------------------------------------------
+// - Get Parallax
+//----------------------------------------------------------------------------
+const sf::Vector2f& Panorama::getParallax() const
+{
+    return parallax_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Parallax
+//----------------------------------------------------------------------------
+// * parallax : fraction of the camera's movement the layer follows on each
+//      axis, where 0 keeps it fixed on screen and 1 moves it with the map.
+//      Background layers are below 1, foreground layers above
+//----------------------------------------------------------------------------
+void Panorama::setParallax(const sf::Vector2f& parallax)
+{
+    parallax_ = parallax;
+}
+
+//----------------------------------------------------------------------------
+// - Get Camera
+//----------------------------------------------------------------------------
+const sf::View* Panorama::getCamera() const
+{
+    return camera_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Camera
+//----------------------------------------------------------------------------
+// * camera : view whose center the layer follows by its parallax, or 0
+//----------------------------------------------------------------------------
+void Panorama::setCamera(const sf::View* camera)
+{
+    camera_ = camera;
+}
 
-    image_.setTextureRect(sf::IntRect(0, 0, roi.x * image_.getTexture()->getSize().x, roi.y * image_.getTexture()->getSize().y));\
-    view_ = sf::View(sf::FloatRect(0, 0, image_.getTexture()->getSize().x, image_.getTexture()->getSize().y));
-    
+//----------------------------------------------------------------------------
+// - Get Color
+//----------------------------------------------------------------------------
+const sf::Color& Panorama::getColor() const
+{
+    return color_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Color
+//----------------------------------------------------------------------------
+// * color : color the texture is modulated by, its alpha making the layer
+//      translucent
+//----------------------------------------------------------------------------
+void Panorama::setColor(const sf::Color& color)
+{
+    color_ = color;
 }
 
 //----------------------------------------------------------------------------
@@ -122,7 +176,7 @@ void Panorama::setROI(const sf::Vector2f& roi)
 //----------------------------------------------------------------------------
 const sf::Texture* Panorama::getTexture() const
 {
-    return image_.getTexture();
+    return texture_;
 }
 
 //----------------------------------------------------------------------------
@@ -135,37 +189,67 @@ void Panorama::setTexture(const sf::Texture& texture)
     // Panoramic textures must repeat
     const_cast<sf::Texture&>(texture).setRepeated(true);
 
-    image_.setTexture(texture);
-    image_.setTextureRect(sf::IntRect(0, 0, roi_.x * texture.getSize().x, roi_.y * texture.getSize().y));
-    view_ = sf::View(sf::FloatRect(0, 0, image_.getTexture()->getSize().x, image_.getTexture()->getSize().y));
-    
+    texture_ = &texture;
+    wake();
 }
 
 //----------------------------------------------------------------------------
-// - Draw Panorama Overlay Image
+// - Draw (Override)
 //----------------------------------------------------------------------------
-// Temporarily replaces the render window's view with a view designed to fit
-// the panoramic view's region of interest, and draws it onto the window
+// Covers the view the target draws through with one quad. The texture offset
+// is the distance panned since the first frame, plus the camera's distance
+// from the origin scaled by the parallax, both converted to texels and wrapped
+// into the texture, which repeats beyond it
 //----------------------------------------------------------------------------
-void Panorama::drawOverlays(sf::RenderTarget& target) const
+void Panorama::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-    sf::View original = target.getView();    
-    target.setView(view_);
-    target.draw(image_);    
-    target.setView(original);
+    sf::Vector2u size = texture_->getSize();
+
+    if(size.x == 0 || size.y == 0)
+    {
+        return;
+    }
+
+    const sf::View& view = target.getView();
+    sf::Vector2f corner = view.getCenter() - view.getSize() / 2.f;
+    sf::Vector2f span(roi_.x * size.x, roi_.y * size.y);
+
+    // Kept in double precision until wrapped, as the panned distance grows
+    double time = frame_ / double(getFPS());
+    double x = -span.x * rate_ * time * cos(direction_);
+    double y = span.y * rate_ * time * sin(direction_);
+
+    if(camera_)
+    {
+        x += camera_->getCenter().x * parallax_.x * span.x / view.getSize().x;
+        y += camera_->getCenter().y * parallax_.y * span.y / view.getSize().y;
+    }
+
+    sf::Vector2f offset(fmod(x, size.x), fmod(y, size.y));
+
+    quad_[0] = sf::Vertex(corner, color_, offset);
+    quad_[1] = sf::Vertex(corner + sf::Vector2f(view.getSize().x, 0), color_, offset + sf::Vector2f(span.x, 0));
+    quad_[2] = sf::Vertex(corner + view.getSize(), color_, offset + span);
+    quad_[3] = sf::Vertex(corner + sf::Vector2f(0, view.getSize().y), color_, offset + sf::Vector2f(0, span.y));
+
+    states.texture = texture_;
+    DrawList::submit(target, quad_, states);
 }
 
 //----------------------------------------------------------------------------
 // - Increment Frame
 //----------------------------------------------------------------------------
-// Updates the panoramic view, shifting the internal drawing rectangle by a
-// fraction equal to 1 / current fps of the total texture size
+// Counts the frames panned, asking for a redraw. Still layers, and layers
+// without an image as in headless simulations, sleep
 //----------------------------------------------------------------------------
 void Panorama::step()
 {
-    const sf::IntRect& textureRect = image_.getTextureRect();
-    panX_ -= textureRect.width * rate_ / getFPS() * cos(direction_);
-    panY_ += textureRect.height * rate_ / getFPS() * sin(direction_);
+    if(rate_ == 0 || texture_->getSize().x == 0)
+    {
+        sleep();
+        return;
+    }
 
-    image_.setTextureRect(sf::IntRect((int)panX_, (int)panY_, textureRect.width, textureRect.height));
-}
+    frame_++;
+    RedrawTracker::instance().request();
+}
\ No newline at end of file
@@ -4,13 +4,22 @@
 #include <SFML/Graphics.hpp>
 #include "../objects/AnimatedObject.h"
 
+// Frame rate at which drifting panoramas are redrawn
+static const float PANORAMA_FPS = 20.0;
+
 //================================================================================
 // ** Panorama
 //================================================================================
-// A panoramic view which pans along a texture image continuously in a given
-// direction (angle) at a default speed of 1 full image rotation per second
+// A background or foreground layer covering the whole view it is drawn
+// through with a single quad of a repeated texture. The texture pans
+// continuously in a given direction (angle), at a default speed of 1 full
+// image rotation per second, and follows a fraction (parallax) of a camera's
+// movement. Texture coordinates are computed afresh from the frame count and
+// camera on each draw, so the layer costs one draw call and never drifts
+// from where it should be. Still layers sleep, drifting ones only wake to
+// redraw
 //================================================================================
-class Panorama : public AnimatedObject
+class Panorama : public sf::Drawable, public AnimatedObject
 {
 // Methods
 public:
@@ -23,25 +32,29 @@ public:
     void                setDirection(float angle);
     const sf::Vector2f& getROI() const;
     void                setROI(const sf::Vector2f& roi);
+    const sf::Vector2f& getParallax() const;
+    void                setParallax(const sf::Vector2f& parallax);
+    const sf::View*     getCamera() const;
+    void                setCamera(const sf::View* camera);
+    const sf::Color&    getColor() const;
+    void                setColor(const sf::Color& color);
     const sf::Texture*  getTexture() const;
     void                setTexture(const sf::Texture& texture);
-    void                drawOverlays(sf::RenderTarget& target) const;
 
 protected:
+    virtual void        draw(sf::RenderTarget& target, sf::RenderStates states) const;
     void                step();
 
 // Members
-    float               rate_;
-    float               direction_;
-    float               panX_;
-    float               panY_;
-    sf::Vector2f        roi_;
-    sf::Sprite          image_;
-    sf::View            view_;
+    const sf::Texture*      texture_;
+    float                   rate_;
+    float                   direction_;
+    sf::Vector2f            roi_;
+    sf::Vector2f            parallax_;
+    const sf::View*         camera_;
+    sf::Color               color_;
+    unsigned long           frame_;
+    mutable sf::VertexArray quad_;
 };
 
-
-// long it takes the sprite to pan
-// through its entire texture
-
 #endif
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "ViewEx.h"
+#include "../game/RedrawTracker.h"
+#include "../game/DrawList.h"
 #include <math.h>
 
 # define M_PI 3.14159265358979323846
@@ -27,6 +29,9 @@ ViewEx::ViewEx(const sf::FloatRect& viewport) :
     tintBox_(sf::RectangleShape(sf::Vector2f(1000, 1000))),
     flashBox_(sf::RectangleShape(sf::Vector2f(1000, 1000)))
 {
+    // Effects only touch this view, reading the focus target at most
+    setConcurrent(true);
+
     // Hide tint and flash box initially
     tintBox_.setFillColor(sf::Color(0, 0, 0, 0));
     flashBox_.setFillColor(sf::Color(0, 0, 0, 0));
@@ -51,6 +56,7 @@ void ViewEx::setCenter(const sf::Vector2f& center)
 {
     sf::View::setCenter(center);
     center_ = center;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -70,6 +76,7 @@ void ViewEx::setCenter(float x, float y)
 void ViewEx::setSize(const sf::Vector2f& size)
 {
     sf::View::setSize(size * zoom_);
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -89,6 +96,7 @@ void ViewEx::move(const sf::Vector2f& offset)
 {
     center_ += offset;
     sf::View::setCenter(getCenter() + offset);
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -110,6 +118,7 @@ void ViewEx::setRotation(float angle)
 {
     sf::View::setRotation(angle);
     rotation_ = angle;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -122,6 +131,7 @@ void ViewEx::rotate(float angle)
 {
     sf::View::rotate(angle);
     rotation_ += angle;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -140,6 +150,7 @@ void ViewEx::zoom(float factor)
         size *= zoom_;
 
         sf::View::setSize(size);        
+        RedrawTracker::instance().request();
     }
 }
 
@@ -188,6 +199,7 @@ void ViewEx::scroll(const sf::Vector2f& offset, float duration)
 {
     scrollTarget_ = center_ + offset;
     scrollLength_ = floor(duration * getFPS());
+    wake();
 }
 
 //----------------------------------------------------------------------------
@@ -200,6 +212,7 @@ void ViewEx::scrollTo(const sf::Vector2f& target, float duration)
 {
     scrollTarget_ = target;
     scrollLength_ = floor(duration * getFPS());
+    wake();
 }
 
 //----------------------------------------------------------------------------
@@ -219,7 +232,22 @@ bool ViewEx::scrolling() const
 //----------------------------------------------------------------------------
 void ViewEx::stopScrolling()
 {
-    scrollLength_ = 0;
+    if(scrollLength_ > 0)
+    {
+        scrollLength_ = 0;
+        scrolled_.emit();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Scroll Signal
+//----------------------------------------------------------------------------
+// Returns the signal emitted when the view reaches its scroll target, or stops
+// scrolling
+//----------------------------------------------------------------------------
+Signal& ViewEx::scrolled()
+{
+    return scrolled_;
 }
 
 //----------------------------------------------------------------------------
@@ -230,6 +258,7 @@ void ViewEx::stopScrolling()
 void ViewEx::focus(const IsometricObject* object)
 {
     focusTarget_ = object;
+    wake();
 }
 
 //----------------------------------------------------------------------------
@@ -278,6 +307,7 @@ void ViewEx::shake(float magnitude, float frequency, float duration, Shake::Dire
 
         shakeLoop_ = duration <= 0;
         shakeDir_ = direction;
+        wake();
     }
 }
 
@@ -317,6 +347,7 @@ void ViewEx::zoom(float factor, float duration)
     {
         zoomRate_ = factor * zoom_ / duration / getFPS();
         zoomLength_ = floor(duration * getFPS());
+        wake();
     }
 }
 
@@ -352,9 +383,10 @@ void ViewEx::spin(float rps, float revolutions, Spin::Direction direction)
 {
     if(rps > 0)
     {
-        spinSpeed_ = rps * 360.f / getFPS() * direction;
+        spinSpeed_ = rps * 360.f / getFPS() * (int)direction;
         spinLength_ = floor(revolutions / rps * getFPS());
         spinLoop_ = revolutions <= 0;
+        wake();
     }
 }
 
@@ -394,6 +426,7 @@ void ViewEx::tint(const sf::Color& color, float duration)
     {
         tintColor_ = color;
         tintLength_ = floor(duration * getFPS());
+        wake();
     }
 }
 
@@ -457,6 +490,7 @@ void ViewEx::flash(float duration, sf::Color color)
 
         // Flash reaches highest opacity at the center of its duration
         flashPeak_ = ceil(flashLength_ / 2.f);
+        wake();
     }
 }
 
@@ -481,10 +515,10 @@ void ViewEx::drawOverlays(sf::RenderTarget& target) const
     sf::View original = target.getView();
     target.setView(sf::View());
 
-    target.draw(tintBox_);
+    DrawList::submit(target, tintBox_);
     if(flashLength_ > 0)
     {
-        target.draw(flashBox_);
+        DrawList::submit(target, flashBox_);
     }
 
     target.setView(original);
@@ -493,10 +527,13 @@ void ViewEx::drawOverlays(sf::RenderTarget& target) const
 //----------------------------------------------------------------------------
 // - Increment Frame
 //----------------------------------------------------------------------------
-// Updates all active screen actions, such as flashing and shaking
+// Updates all active screen actions, such as flashing and shaking. The view
+// is only awake while an action is under way, so every step redraws
 //----------------------------------------------------------------------------
 void ViewEx::step()
 {
+    RedrawTracker::instance().request();
+
     // Update Focusing
     if(focusTarget_)
     {
@@ -509,6 +546,11 @@ void ViewEx::step()
     {
         center_ += (scrollTarget_ - center_) / (float)scrollLength_--;
         sf::View::setCenter(center_);
+
+        if(scrollLength_ == 0)
+        {
+            scrolled_.emit();
+        }
     }
 
     // Update Shaking
@@ -522,7 +564,7 @@ void ViewEx::step()
             wave *= shakeLength_ / shakePeak_;
         }
 
-        sf::View::setCenter(center_ + sf::Vector2f(wave * (1 - shakeDir_), wave * shakeDir_));
+        sf::View::setCenter(center_ + sf::Vector2f(wave * (1 - (int)shakeDir_), wave * (int)shakeDir_));
     }
 
     // Update Zooming
@@ -571,4 +613,10 @@ void ViewEx::step()
         flashBox_.setFillColor(flash);
         flashLength_--;
     }
+
+    // Idle until given a new effect
+    if(!focusing() && !scrolling() && !shaking() && !zooming() && !spinning() && !tinting() && !flashing())
+    {
+        sleep();
+    }
 }
\ No newline at end of file
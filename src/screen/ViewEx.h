@@ -4,6 +4,7 @@
 #include <SFML/Graphics.hpp>
 #include "../objects/AnimatedObject.h"
 #include "../objects/IsometricObject.h"
+#include "../game/Signal.h"
 #include "../settings.h"
 
 namespace Shake{
@@ -46,6 +47,7 @@ public:
     void                scroll(const sf::Vector2f& offset, float duration);
     void                scrollTo(const sf::Vector2f& target, float duration);
     bool                scrolling() const;
+    Signal&             scrolled();
     void                stopScrolling();
     
     // Enhanced functions - Focusing
@@ -99,6 +101,7 @@ protected:
 
     sf::Vector2f        scrollTarget_;
     int                 scrollLength_;
+    Signal              scrolled_;
 
     const IsometricObject* focusTarget_;
 
@@ -4,7 +4,14 @@
 #include <SFML/Graphics.hpp>
 
 static const float FPS = 60.0;
+static const float MAX_ELAPSED = 0.25;
+static const int MAX_STEPS_PER_FRAME = 5;
 static const sf::Vector3f MAP_SCALE(32, 16, 8);
 static const sf::Vector2f ASPECT_RATIO(640, 480);
 
+// Display pacing: frames drawn per second at most (0 for no limit), and
+// whether to wait for the monitor's vertical sync instead
+static const unsigned FRAME_LIMIT = 60;
+static const bool VSYNC = false;
+
 #endif
\ No newline at end of file
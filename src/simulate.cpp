@@ -0,0 +1,54 @@
+#include "game/Scene.h"
+#include "game/Simulation.h"
+#include "game/InputManager.h"
+#include "control/ScriptedInput.h"
+#include <iostream>
+#include <cstdlib>
+#include <random>
+
+//================================================================================
+// ** Tactics Headless Simulation
+//================================================================================
+// Runs a scene with no window at a fixed timestep and maximum speed, driven by
+// a seeded random player pressing keys whenever a handler polls for input. The
+// same seed always plays out the same game, ending with the same state hash.
+// Usage: simulate [seed] [turns] [frames]
+//================================================================================
+int main(int argc, char** argv)
+{
+    unsigned seed = argc > 1 ? strtoul(argv[1], 0, 10) : 1;
+    int turns = argc > 2 ? atoi(argv[2]) : 1000;
+    unsigned long frames = argc > 3 ? strtoul(argv[3], 0, 10) : 10000000;
+
+    Simulation simulation(seed);
+
+    // Random player moving about, confirming and now and then backing out, but
+    // never from the main cursor, as that leads to the main menu which quits
+    static const sf::Keyboard::Key keys[] = {
+        sf::Keyboard::Up, sf::Keyboard::Down, sf::Keyboard::Left, sf::Keyboard::Right,
+        sf::Keyboard::Return, sf::Keyboard::Return, sf::Keyboard::Escape
+    };
+    std::mt19937 random(seed);
+
+    ScriptedInput input;
+    input.setGenerator([&random](){
+        sf::Keyboard::Key key = keys[random() % 7];
+        return key == sf::Keyboard::Escape && InputManager::instance().size() < 2 ? sf::Keyboard::Return : key;
+    });
+    InputManager::instance().setSource(&input);
+
+    Scene scene;
+    scene.start();
+
+    sf::Clock clock;
+    unsigned long stepped = simulation.run(scene, turns, frames);
+    float elapsed = clock.getElapsedTime().asSeconds();
+
+    InputManager::instance().setSource(0);
+
+    std::cout << "Seed " << seed << ": " << scene.turn() << " turns, " << stepped << " frames, " << input.polls() << " polls" << (scene.closed() ? ", closed" : "") << std::endl;
+    std::cout << "  " << elapsed << "s, " << scene.turn() / elapsed << " turns/s, " << stepped / elapsed << " frames/s" << std::endl;
+    std::cout << "  state hash " << std::hex << scene.hash() << std::dec << std::endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "SpriteActor.h"
+#include "../game/DrawList.h"
 
 //----------------------------------------------------------------------------
 // - Actor Sprite Contructor
@@ -46,5 +47,5 @@ void SpriteActor::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     states.transform *= getTransform();
 
-    target.draw(*sprite_, states);
+    DrawList::submit(target, *sprite_, states);
 }
\ No newline at end of file
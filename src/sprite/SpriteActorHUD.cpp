@@ -1,18 +1,30 @@
 #include "SpriteActorHUD.h"
+#include "../game/RedrawTracker.h"
+#include "../game/DrawList.h"
 
 //----------------------------------------------------------------------------
 // - Sprite Actor HUD Default Constructor
 //----------------------------------------------------------------------------
 SpriteActorHUD::SpriteActorHUD() :
+actor_(0),
 portrait_(0),
 body_(sf::Vector2f(180, 80)),
+name_(12, true),
+lvl_("Lvl 1", 12, true),
+hpLabel_("HP", 12, true),
+hpValue_(12, true),
+mpLabel_("MP", 12, true),
+mpValue_(12, true),
 visible_(true),
 empty_(true)
 {
-    font_.loadFromFile("resources/fonts/Arial.ttf");
-
     body_.setPosition(0, 40);
     body_.setFillColor(sf::Color(50, 50, 170, 200));
+
+    // Fixed labels
+    lvl_.setPosition(4, 112 - lvl_.getLocalBounds().height);
+    hpLabel_.setPosition(72, 76);
+    mpLabel_.setPosition(72, 96);
 }
 
 //----------------------------------------------------------------------------
@@ -36,47 +48,41 @@ SpriteActorHUD::~SpriteActorHUD()
 // - Set Actor
 //----------------------------------------------------------------------------
 // * actor : player this HUD displays information for
+// Setting the actor already displayed keeps the HUD as it is
 //----------------------------------------------------------------------------
 void SpriteActorHUD::setActor(const Actor* actor)
 {
+    if(actor == actor_)
+    {
+        return;
+    }
+
     if(actor != 0)
     {
         // Portrait
-    portrait_ = actor->getPortrait();
-    
+        portrait_ = actor->getPortrait();
+
         if(portrait_)
         {
-            portrait_->setPosition(0, 16);        
+            portrait_->setPosition(0, 16);
         }
-    
-        // Level
-        lvl_ = sf::Text("Lvl 1", font_, 12);
-        lvl_.setStyle(sf::Text::Bold);
-        lvl_.setPosition(4, 112 - lvl_.getGlobalBounds().height);
-    
+
         // Name
-        name_ = sf::Text(actor->getName(), font_, 12);
-        name_.setStyle(sf::Text::Bold);
-        name_.setPosition(124 - name_.getGlobalBounds().width / 2.f, 52);
-    
+        name_.setString(actor->getName());
+        name_.setPosition(124 - name_.getLocalBounds().width / 2.f, 52);
+
         // HP
-        hpLabel_ = sf::Text("HP", font_, 12);
-        hpLabel_.setStyle(sf::Text::Bold);
-        hpLabel_.setPosition(72, 76);
-        hpValue_ = sf::Text("100 / 100", font_, 12);
-        hpValue_.setStyle(sf::Text::Bold);
-        hpValue_.setPosition(168 - hpValue_.getGlobalBounds().width, 76);
-    
+        hpValue_.setString("100 / 100");
+        hpValue_.setPosition(168 - hpValue_.getLocalBounds().width, 76);
+
         // MP
-        mpLabel_ = sf::Text("MP", font_, 12);
-        mpLabel_.setStyle(sf::Text::Bold);
-        mpLabel_.setPosition(72, 96);
-        mpValue_ = sf::Text("10 / 10", font_, 12);
-        mpValue_.setStyle(sf::Text::Bold);
-        mpValue_.setPosition(168 - mpValue_.getGlobalBounds().width, 96);
+        mpValue_.setString("10 / 10");
+        mpValue_.setPosition(168 - mpValue_.getLocalBounds().width, 96);
     }
 
+    actor_ = actor;
     empty_ = actor == 0;
+    invalidate();
 }
 
 //----------------------------------------------------------------------------
@@ -93,6 +99,7 @@ bool SpriteActorHUD::visible() const
 void SpriteActorHUD::show()
 {
     visible_ = true;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -101,6 +108,7 @@ void SpriteActorHUD::show()
 void SpriteActorHUD::hide()
 {
     visible_ = false;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -121,6 +129,14 @@ sf::FloatRect SpriteActorHUD::getGlobalBounds() const
     return sf::FloatRect(0, 0, 180, 120);
 }
 
+//----------------------------------------------------------------------------
+// - Get Cached Area (Override)
+//----------------------------------------------------------------------------
+sf::FloatRect SpriteActorHUD::area() const
+{
+    return getGlobalBounds();
+}
+
 //----------------------------------------------------------------------------
 // - Draw (Override)
 //----------------------------------------------------------------------------
@@ -128,19 +144,26 @@ void SpriteActorHUD::draw(sf::RenderTarget& target, sf::RenderStates states) con
 {
     if(visible_ && !empty_)
     {
-        states.transform *= getTransform();
-        target.draw(body_, states);
+        SpriteCached::draw(target, states);
+    }
+}
 
-        if(portrait_)
-        {
-            target.draw(*portrait_, states);
-        }
-    
-        target.draw(name_, states);
-        target.draw(lvl_, states);
-        target.draw(hpLabel_, states);
-        target.draw(hpValue_, states);
-        target.draw(mpLabel_, states);
-        target.draw(mpValue_, states);
+//----------------------------------------------------------------------------
+// - Render Content (Override)
+//----------------------------------------------------------------------------
+void SpriteActorHUD::render(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    DrawList::submit(target, body_, states);
+
+    if(portrait_)
+    {
+        DrawList::submit(target, *portrait_, states);
     }
+
+    target.draw(name_, states);
+    target.draw(lvl_, states);
+    target.draw(hpLabel_, states);
+    target.draw(hpValue_, states);
+    target.draw(mpLabel_, states);
+    target.draw(mpValue_, states);
 }
@@ -2,14 +2,16 @@
 #define TACTICS_SPRITE_ACTOR_HUD_H
 
 #include "../objects/Actor.h"
-#include "Sprite.h"
+#include "SpriteCached.h"
+#include "TextLabel.h"
 
 //================================================================================
 // ** Sprite Actor HUD
 //================================================================================
-// Displays the actor's portrait, name and other vital stats in an overlay HUD
+// Displays the actor's portrait, name and other vital stats in an overlay HUD,
+// laid out and rendered again only when the actor displayed changes
 //================================================================================
-class SpriteActorHUD : public Sprite
+class SpriteActorHUD : public SpriteCached
 {
 // Methods
 public:
@@ -27,17 +29,19 @@ public:
     
 protected:
     virtual void        draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    virtual void        render(sf::RenderTarget& target, sf::RenderStates states) const;
+    virtual sf::FloatRect area() const;
 
 // Members
+    const Actor*        actor_;
     sf::Sprite*         portrait_;
     sf::RectangleShape  body_;
-    sf::Text            name_;
-    sf::Text            lvl_;
-    sf::Text            hpLabel_;
-    sf::Text            hpValue_;
-    sf::Text            mpLabel_;
-    sf::Text            mpValue_;
-    sf::Font            font_;
+    TextLabel           name_;
+    TextLabel           lvl_;
+    TextLabel           hpLabel_;
+    TextLabel           hpValue_;
+    TextLabel           mpLabel_;
+    TextLabel           mpValue_;
     bool                visible_;
     bool                empty_;
 };
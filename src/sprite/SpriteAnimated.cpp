@@ -1,4 +1,5 @@
 #include "SpriteAnimated.h"
+#include "../game/DrawList.h"
 #include <math.h>
 
 //----------------------------------------------------------------------------
@@ -10,11 +11,15 @@ SpriteAnimated::SpriteAnimated(SpriteIndexed* sprite) :
     AnimatedObject(1),
     current_(0),
     playing_(""),
+    clip_(0),
     length_(-1),
     sprite_(sprite)
 {    
-    if(sprite_){
-        // Add default sequence -> 0 .. index limit
+    // Frame advancement only touches this sprite
+    setConcurrent(true);
+
+    if(sprite_ && !has("default")){
+        // Add default sequence -> 0 .. index limit, unless the sheet has one
         std::vector<int> defaultSequence(sprite_->getIndexLimit());
         for(int i = 0; i < defaultSequence.size(); i++)
         {
@@ -41,15 +46,16 @@ SpriteAnimated::~SpriteAnimated()
 //----------------------------------------------------------------------------
 // * name : name of the sequence used to identify it within the sprite
 // * sequence : vector of indices that comprises the animation
-// Adds a new animation sequence to this sprite, which will be iterated
+// Adds a new animation sequence to the sprite's sheet, which will be iterated
 // through each frame while playing
-// NOTE: will override an sequence of the same name if it exists
+// NOTE: sheets are shared, so a sequence of the same name already on the
+// sheet is kept instead
 //----------------------------------------------------------------------------
 void SpriteAnimated::add(const std::string& name, const std::vector<int>& sequence)
 {
-    if(!sequence.empty() && name != "")
+    if(sprite_)
     {
-        animations_[name] = sequence;
+        sprite_->getSheet().addClip(name, sequence);
     }
 }
 
@@ -61,22 +67,7 @@ void SpriteAnimated::add(const std::string& name, const std::vector<int>& sequen
 //----------------------------------------------------------------------------
 bool SpriteAnimated::has(const std::string& name) const
 {
-    return animations_.find(name) != animations_.end();
-}
-
-//----------------------------------------------------------------------------
-// - Remove Animation
-//----------------------------------------------------------------------------
-// * name : name of the sequence to remove from the sprite
-//----------------------------------------------------------------------------
-void SpriteAnimated::remove(const std::string& name)
-{
-    if(playing_ == name)
-    {
-        stop();
-    }
-
-    animations_.erase(name);    
+    return sprite_ && sprite_->getSheet().getClip(name);
 }
 
 //----------------------------------------------------------------------------
@@ -91,8 +82,10 @@ void SpriteAnimated::play(const std::string& name, bool looping)
     if(name != ""){
         current_ = 0;
         playing_ = name;
+        clip_ = sprite_ ? sprite_->getSheet().getClip(name) : 0;
         length_ = -1;
         loop_ = looping;
+        wake();
     }
     
 }
@@ -110,8 +103,10 @@ void SpriteAnimated::playFor(const std::string& name, float duration)
     {
         current_ = 0;
         playing_ = name;
+        clip_ = sprite_ ? sprite_->getSheet().getClip(name) : 0;
         length_ = floor(duration * getFPS());
         loop_ = false;
+        wake();
     }    
 }
 
@@ -128,7 +123,21 @@ bool SpriteAnimated::playing() const
 //----------------------------------------------------------------------------
 void SpriteAnimated::stop()
 {
-    playing_ = "";
+    if(playing_ != "")
+    {
+        playing_ = "";
+        finished_.emit();
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Finished Signal
+//----------------------------------------------------------------------------
+// Returns the signal emitted when the playing animation ends or is stopped
+//----------------------------------------------------------------------------
+Signal& SpriteAnimated::finished()
+{
+    return finished_;
 }
 
 //----------------------------------------------------------------------------
@@ -155,6 +164,7 @@ const SpriteIndexed* SpriteAnimated::getSprite() const
 void SpriteAnimated::setSprite(SpriteIndexed* sprite)
 {
     sprite_ = sprite;
+    clip_ = 0;
     stop();
 }
 
@@ -192,13 +202,16 @@ void SpriteAnimated::draw(sf::RenderTarget& target, sf::RenderStates states) con
     if(sprite_)
     {
         states.transform *= getTransform();
-        target.draw(*sprite_, states);
+        DrawList::submit(target, *sprite_, states);
     }
 }
 
 //----------------------------------------------------------------------------
 // - Increment Frame
 //----------------------------------------------------------------------------
+// Plays the clip found when the animation started, so no frame looks its
+// name up again. Unknown animations play as empty ones
+//----------------------------------------------------------------------------
 void SpriteAnimated::step()
 {
     if(length_ == 0)
@@ -208,9 +221,11 @@ void SpriteAnimated::step()
     
     if(playing_ != "")
     {
-        if(current_ < animations_[playing_].size())
+        int size = clip_ ? clip_->size() : 0;
+
+        if(current_ < size)
         {
-            sprite_->setIndex(animations_[playing_][current_++]);
+            sprite_->setIndex((*clip_)[current_++]);
             
             if(length_ > 0)
             {
@@ -218,7 +233,7 @@ void SpriteAnimated::step()
             }
         }
 
-        if(current_ == animations_[playing_].size())
+        if(current_ == size)
         {
             if(loop_ || length_ > 0)
             {
@@ -235,4 +250,10 @@ void SpriteAnimated::step()
             }
         }
     }
+
+    // Idle until played again
+    if(playing_ == "")
+    {
+        sleep();
+    }
 }
\ No newline at end of file
@@ -4,14 +4,15 @@
 #include "../objects/AnimatedObject.h"
 #include "Sprite.h"
 #include "SpriteIndexed.h"
-#include <map>
+#include "../game/Signal.h"
 #include <vector>
 #include <string>
 
 //================================================================================
 // ** Sprite Animated
 //================================================================================
-// Animated sprite which plays animations: named sequences of sprite sheet indices
+// Animated sprite which plays animations: named sequences of sprite sheet
+// indices, kept as clips by the sheet and shared by all sprites using it
 //================================================================================
 class SpriteAnimated : public Sprite, public AnimatedObject
 {
@@ -22,11 +23,11 @@ public:
 
     void                        add(const std::string& name, const std::vector<int>& sequence);
     bool                        has(const std::string& name) const;
-    void                        remove(const std::string& name);
     void                        play(const std::string& name = "default", bool looping = false);
     void                        playFor(const std::string& name = "default", float duration = -1);
     bool                        playing() const;
     void                        stop();
+    Signal&                     finished();
     SpriteIndexed*              getSprite();
     const SpriteIndexed*        getSprite() const;
     void                        setSprite(SpriteIndexed* sprite);
@@ -40,10 +41,11 @@ protected:
 // Members
     int                         current_;
     std::string                 playing_;
+    const std::vector<int>*     clip_;
     SpriteIndexed*              sprite_;
     int                         length_;
     bool                        loop_;
-    std::map<std::string, std::vector<int>> animations_;
+    Signal                      finished_;
 };
 
 #endif
\ No newline at end of file
@@ -1,16 +1,17 @@
 #include "SpriteArea.h"
+#include "../game/RedrawTracker.h"
 #include <math.h>
 
 //----------------------------------------------------------------------------
 // - Sprite Area Constructor
 //----------------------------------------------------------------------------
-// * texture : bitmap to use for the sprites to be drawn at position of
+// * texture : bitmap, or region of one, to use for the sprites to be drawn at position of
 //      interest
 // * area : set of positions that describe the area of interest
 // * map : height map used to determine each positions height
 // * color : color of the area of interest
 //----------------------------------------------------------------------------
-SpriteArea::SpriteArea(const sf::Texture& texture, const std::vector<sf::Vector2f>& area, const Map& map, const sf::Color& color) :
+SpriteArea::SpriteArea(const TextureRegion& texture, const std::vector<sf::Vector2f>& area, const Map& map, const sf::Color& color) :
     area_(area.size(), SpriteAreaSquare(texture, color))
 {
     for(int i = 0; i < area_.size(); i++)
@@ -84,6 +85,7 @@ bool SpriteArea::visible() const
 void SpriteArea::show()
 {
     visible_ = true;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
@@ -92,6 +94,7 @@ void SpriteArea::show()
 void SpriteArea::hide()
 {
     visible_ = false;
+    RedrawTracker::instance().request();
 }
 
 //----------------------------------------------------------------------------
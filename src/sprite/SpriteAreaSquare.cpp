@@ -1,13 +1,14 @@
 #include "SpriteAreaSquare.h"
+#include "../game/DrawList.h"
 
 //----------------------------------------------------------------------------
 // - Sprite Area Constructor
 //----------------------------------------------------------------------------
-// * texture : bitmap of a single area square
+// * texture : bitmap, or region of one, of a single area square
 // * color : coloring of the affected area, e.g blue for a move square
 //----------------------------------------------------------------------------
-SpriteAreaSquare::SpriteAreaSquare(const sf::Texture& texture, const sf::Color& color) :
-    sprite_(texture)
+SpriteAreaSquare::SpriteAreaSquare(const TextureRegion& texture, const sf::Color& color) :
+    sprite_(*texture.getTexture(), texture.getRect())
 {
     sprite_.setColor(color);
     sprite_.setOrigin(texture.getSize().x / 2, texture.getSize().y / 2);
@@ -44,5 +45,5 @@ float SpriteAreaSquare::getHeight(const sf::Vector2f& position) const
 //----------------------------------------------------------------------------
 void SpriteAreaSquare::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-    target.draw(sprite_, states);
+    DrawList::submit(target, sprite_, states);
 }
\ No newline at end of file
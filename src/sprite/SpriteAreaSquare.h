@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "../objects/IsometricObject.h"
+#include "TextureRegion.h"
 
 //================================================================================
 // * Sprite Area Square
@@ -13,7 +14,7 @@ class SpriteAreaSquare : public IsometricObject
 {
 // Methods
 public:
-    SpriteAreaSquare(const sf::Texture& texture, const sf::Color& color);
+    SpriteAreaSquare(const TextureRegion& texture, const sf::Color& color);
     virtual ~SpriteAreaSquare();
 
     virtual sf::FloatRect   getGlobalBounds() const;
@@ -0,0 +1,142 @@
+#include "SpriteCached.h"
+#include "../game/Simulation.h"
+#include "../game/RedrawTracker.h"
+#include "../game/DrawList.h"
+#include <algorithm>
+#include <math.h>
+
+//----------------------------------------------------------------------------
+// - Cached Sprite Constructor
+//----------------------------------------------------------------------------
+SpriteCached::SpriteCached() :
+    last_(CACHE_SLOTS - 1),
+    version_(1)
+{
+    for(Slot& slot : slots_)
+    {
+        slot.target = 0;
+        slot.cache = 0;
+        slot.version = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Cached Sprite Destructor
+//----------------------------------------------------------------------------
+SpriteCached::~SpriteCached()
+{
+    for(Slot& slot : slots_)
+    {
+        if(slot.cache)
+        {
+            delete slot.cache;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Invalidate Cache
+//----------------------------------------------------------------------------
+// Marks the content as changed, re-rendering it into each cache on its next
+// draw
+//----------------------------------------------------------------------------
+void SpriteCached::invalidate()
+{
+    version_++;
+    RedrawTracker::instance().request();
+}
+
+//----------------------------------------------------------------------------
+// - Cache Is Valid?
+//----------------------------------------------------------------------------
+// Returns whether the cache last drawn holds the current content
+//----------------------------------------------------------------------------
+bool SpriteCached::valid() const
+{
+    return slots_[last_].version == version_;
+}
+
+//----------------------------------------------------------------------------
+// - Draw (Override)
+//----------------------------------------------------------------------------
+// Re-renders the content into the target's cache if it was invalidated since,
+// then draws the cache. The cache holds colors already multiplied by their
+// alpha, as content was blended onto a transparent texture, so it is drawn
+// without multiplying again. A target without a cache of its own takes over
+// the one drawn least recently. Should no texture be available, the content
+// is rendered directly
+//----------------------------------------------------------------------------
+void SpriteCached::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    states.transform *= getTransform();
+
+    sf::FloatRect bounds = area();
+    sf::Vector2f corner(floor(bounds.left), floor(bounds.top));
+    sf::Vector2u size(ceil(bounds.left + bounds.width - corner.x), ceil(bounds.top + bounds.height - corner.y));
+
+    if(size.x == 0 || size.y == 0)
+    {
+        return;
+    }
+    else if(Simulation::headless())
+    {
+        render(target, states);
+        return;
+    }
+
+    // Draw lists alternate, so each finds its own cache, which the render
+    // thread is done with by the time the list is recorded again
+    int s = 0;
+    while(s < CACHE_SLOTS && slots_[s].target != &target)
+    {
+        s++;
+    }
+
+    if(s == CACHE_SLOTS)
+    {
+        s = (last_ + 1) % CACHE_SLOTS;
+        slots_[s].target = &target;
+        slots_[s].version = 0;
+    }
+
+    Slot& slot = slots_[s];
+    last_ = s;
+
+    if(slot.version != version_ || !slot.cache)
+    {
+        if(!slot.cache || slot.cache->getSize().x < size.x || slot.cache->getSize().y < size.y)
+        {
+            sf::Vector2u grown(size);
+
+            if(slot.cache)
+            {
+                grown.x = std::max(grown.x, slot.cache->getSize().x);
+                grown.y = std::max(grown.y, slot.cache->getSize().y);
+                delete slot.cache;
+                slot.cache = 0;
+            }
+
+            slot.cache = new sf::RenderTexture;
+
+            if(!slot.cache->create(grown.x, grown.y))
+            {
+                delete slot.cache;
+                slot.cache = 0;
+                render(target, states);
+                return;
+            }
+        }
+
+        slot.cache->clear(sf::Color::Transparent);
+        render(*slot.cache, sf::RenderStates(sf::Transform().translate(-corner.x, -corner.y)));
+        slot.cache->display();
+
+        slot.quad.setTexture(slot.cache->getTexture());
+        slot.quad.setTextureRect(sf::IntRect(0, 0, size.x, size.y));
+        slot.quad.setPosition(corner);
+        slot.version = version_;
+    }
+
+    states.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+    DrawList::submit(target, slot.quad, states);
+}
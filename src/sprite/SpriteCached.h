@@ -0,0 +1,59 @@
+#ifndef TACTICS_SPRITE_CACHED_H
+#define TACTICS_SPRITE_CACHED_H
+
+#include <SFML/Graphics.hpp>
+#include "Sprite.h"
+
+// Cache textures kept per sprite, one for each of the renderer's draw lists
+static const int CACHE_SLOTS = 2;
+
+//================================================================================
+// ** Sprite Cached
+//================================================================================
+// A retained-mode sprite which renders its content once into a texture of its
+// own, then draws it as a single textured quad every frame until invalidated.
+// Derived widgets render their content in local coordinates, covering the
+// area they report, and invalidate the cache whenever that content changes.
+// The cache keeps its texture while the area fits, growing it as needed.
+// Each target drawn onto has a cache of its own, so that under the threaded
+// renderer, the cache a draw list is recorded with is never re-rendered while
+// the render thread plays that list; content changes are then rendered once
+// per list. Recorded lists refer to the caches, so a cached sprite must
+// outlive the frames it was recorded into. Headless simulations render
+// directly, never creating a texture
+//================================================================================
+class SpriteCached : public Sprite
+{
+// Methods
+private:
+    SpriteCached(const SpriteCached&);
+
+public:
+    SpriteCached();
+    virtual ~SpriteCached();
+
+    void                        invalidate();
+    bool                        valid() const;
+
+protected:
+    virtual void                draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    virtual void                render(sf::RenderTarget& target, sf::RenderStates states) const = 0;
+    virtual sf::FloatRect       area() const = 0;
+
+private:
+    // Cache Slot Sub-structure
+    struct Slot
+    {
+        const sf::RenderTarget*     target;
+        sf::RenderTexture*          cache;
+        sf::Sprite                  quad;
+        unsigned                    version;
+    };
+
+// Members
+    mutable Slot                slots_[CACHE_SLOTS];
+    mutable int                 last_;
+    unsigned                    version_;
+};
+
+#endif
\ No newline at end of file
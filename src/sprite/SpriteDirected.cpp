@@ -1,24 +1,27 @@
 #include "SpriteDirected.h"
+#include "../game/RedrawTracker.h"
 
 //----------------------------------------------------------------------------
 // - Directed Sprite Constructor
 //----------------------------------------------------------------------------
-// * texture : bitmap sprite sheet this sprite derives from
+// * sheet : bitmap sprite sheet, or region of one, this sprite derives from
 // * width : width in pixels of a single frame in the sheet
 // * height : height in pixels of a single frame in the sheet
 // * directions : number of orthagonal directions for this sprite sheet
 //----------------------------------------------------------------------------
-SpriteDirected::SpriteDirected(const sf::Texture & texture, int width, int height, int directions) :
-	SpriteIndexed(texture)
-{
-	setDirections(directions);
-	setWidth(width);
-	setHeight(height);
+SpriteDirected::SpriteDirected(const TextureRegion& sheet, int width, int height, int directions) :
+	SpriteDirected(SpriteSheet::get(sheet, width, height, directions))
+{}
 
-    if(height_ != height)
-    {
-	    setHeight(heightLimit());	
-    }
+//----------------------------------------------------------------------------
+// - Directed Sprite Constructor (Sheet)
+//----------------------------------------------------------------------------
+// * sheet : shared sprite sheet split into rows of directions
+//----------------------------------------------------------------------------
+SpriteDirected::SpriteDirected(SpriteSheet& sheet) :
+	SpriteIndexed(sheet),
+	direction_(0)
+{
 }
 
 //----------------------------------------------------------------------------
@@ -44,7 +47,7 @@ int SpriteDirected::getDirection() const
 //----------------------------------------------------------------------------
 void SpriteDirected::setDirection(int direction)
 {
-	if (direction >= 0 && direction < directions_)
+	if (direction >= 0 && direction < getDirections())
     {
         direction_ = direction;
         updateFrame();
@@ -56,64 +59,37 @@ void SpriteDirected::setDirection(int direction)
 //----------------------------------------------------------------------------
 int SpriteDirected::getDirections() const
 {
-	return directions_;
+	return sheet_->getDirections();
 }
 
 //----------------------------------------------------------------------------
 // - Set Number of Directions
 //----------------------------------------------------------------------------
-// * directions : orthagonal directions to splite the sheet into as rows
+// * directions : orthagonal directions to splite the sheet into as rows. An
+//      empty sheet takes any number, so facing is kept even without graphics
 //----------------------------------------------------------------------------
 void SpriteDirected::setDirections(int directions)
 {
-	if(directions > 0 && directions <= int(getTexture()->getSize().x * getTexture()->getSize().y))
+	const TextureRegion& region = sheet_->getRegion();
+	int height = region.getRect().height;
+
+	if(directions > 0 && (height == 0 || directions <= height))
     {
-        directions_ = directions;
         direction_ = 0;
-
-        updateFrame();
+        setSheet(SpriteSheet::get(region, getWidth(), getHeight(), directions));
     }
 }
 
-//----------------------------------------------------------------------------
-// - Get Index Limit (Override)
-//----------------------------------------------------------------------------
-// Override which takes directions into account, returning the index limit for
-// a single row rather the entire texture
-//----------------------------------------------------------------------------
-int SpriteDirected::getIndexLimit() const
-{
-	return SpriteIndexed::getIndexLimit() / directions_;
-}
-
-//----------------------------------------------------------------------------
-// - Get Height Limit (Override)
-//----------------------------------------------------------------------------
-// Override which takes directions into account, returning the height limit for
-// a single row rather the entire texture
-//----------------------------------------------------------------------------
-int SpriteDirected::heightLimit() const
-{
-	return SpriteIndexed::heightLimit() / directions_;
-}
-
 //----------------------------------------------------------------------------
 // - Update Texture Sub-Rectangle
 //----------------------------------------------------------------------------
-// Override which now includes splitting the sequences of images further into
-// major rows as directions
+// Override which looks the frame up in the row of the current direction
 //----------------------------------------------------------------------------
 void SpriteDirected::updateFrame()
 {
-	int index = getIndex() + direction_ * getIndexLimit();
-	int xTiles = getTexture()->getSize().x / getWidth();
+	if (sheet_->getFrames() == 0)
+		return;
 
-	sf::Sprite::setTextureRect(sf::IntRect(
-		getWidth() * (index % xTiles),
-		getHeight() * (index / xTiles),
-		getWidth(),
-		getHeight())
-    );
+	sf::Sprite::setTextureRect(sheet_->frame(getIndex(), direction_));
+	RedrawTracker::instance().request();
 }
-
-
@@ -12,21 +12,19 @@ class SpriteDirected : public SpriteIndexed
 {
 // Methods
 public:
-	SpriteDirected(const sf::Texture& texture, int width = 0, int height = 0, int directions = 4);
+	SpriteDirected(const TextureRegion& sheet, int width = 0, int height = 0, int directions = 4);
+	SpriteDirected(SpriteSheet& sheet);
 	virtual ~SpriteDirected();
 
 	int 			getDirection() const;
 	void 			setDirection(int direction);
 	int 			getDirections() const;
 	void 			setDirections(int directions);
-	virtual int 	getIndexLimit() const;
 
 protected:
-	virtual int 	heightLimit() const;
 	virtual void 	updateFrame();
 
 // Members
-	int 			directions_;
 	int 			direction_;
 };
 
@@ -1,19 +1,27 @@
 #include "SpriteIndexed.h"
+#include "../game/RedrawTracker.h"
 
 //----------------------------------------------------------------------------
 // - Indexed Sprite Constructor
 //----------------------------------------------------------------------------
-// * texture : bitmap sprite sheet this sprite derives from
+// * sheet : bitmap sprite sheet, or region of one, this sprite derives from
 // * width : width in pixels of a single frame in the sheet
 // * height : height in pixels of a single frame in the sheet
 //----------------------------------------------------------------------------
-SpriteIndexed::SpriteIndexed(const sf::Texture &texture, int width, int height) :
-	sf::Sprite(texture),
-	index_(0),
-	width_((0 < width  && width < widthLimit())  ? width  : texture.getSize().x),
-	height_((0 < height && height < heightLimit()) ? height : texture.getSize().y)
+SpriteIndexed::SpriteIndexed(const TextureRegion& sheet, int width, int height) :
+	SpriteIndexed(SpriteSheet::get(sheet, width, height))
+{}
+
+//----------------------------------------------------------------------------
+// - Indexed Sprite Constructor (Sheet)
+//----------------------------------------------------------------------------
+// * sheet : shared sprite sheet this sprite displays the frames of
+//----------------------------------------------------------------------------
+SpriteIndexed::SpriteIndexed(SpriteSheet& sheet) :
+	sheet_(0),
+	index_(0)
 {
-	sf::Sprite::setTextureRect(sf::IntRect(0, 0, width_, height_));
+	setSheet(sheet);
 }
 
 //----------------------------------------------------------------------------
@@ -52,7 +60,7 @@ void SpriteIndexed::setIndex(int index)
 //----------------------------------------------------------------------------
 int SpriteIndexed::getWidth() const
 {
-	return width_;
+	return sheet_->getWidth();
 }
 
 
@@ -63,11 +71,12 @@ int SpriteIndexed::getWidth() const
 //----------------------------------------------------------------------------
 void SpriteIndexed::setWidth(int width)
 {
-	if (width > 0 && width <= widthLimit())
+	const TextureRegion& region = sheet_->getRegion();
+
+	if (width > 0 && width <= region.getRect().width)
     {
-        width_ = width;
         index_ = 0;
-        updateFrame();
+        setSheet(SpriteSheet::get(region, width, getHeight(), sheet_->getDirections()));
     }
 }
 
@@ -76,7 +85,7 @@ void SpriteIndexed::setWidth(int width)
 //----------------------------------------------------------------------------
 int SpriteIndexed::getHeight() const
 {
-	return height_;
+	return sheet_->getHeight();
 }
 
 //----------------------------------------------------------------------------
@@ -86,88 +95,88 @@ int SpriteIndexed::getHeight() const
 //----------------------------------------------------------------------------
 void SpriteIndexed::setHeight(int height)
 {
-	if (height > 0 && height <= heightLimit())
+	const TextureRegion& region = sheet_->getRegion();
+
+	if (height > 0 && height <= region.getRect().height / sheet_->getDirections())
     {
-        height_ = height;
         index_ = 0;
-        updateFrame();
+        setSheet(SpriteSheet::get(region, getWidth(), height, sheet_->getDirections()));
     }
 }
 
 //----------------------------------------------------------------------------
 // - Set Texture (Override)
 //----------------------------------------------------------------------------
-// * texture : bitmap sprite sheet this sprite derives from
-// Overrides set texture to handle any indexing discrepancies
+// * sheet : bitmap sprite sheet, or region of one, this sprite derives from
+// Overrides set texture to cut the new sheet the same way, where it fits
 //----------------------------------------------------------------------------
-void SpriteIndexed::setTexture(const sf::Texture & texture)
+void SpriteIndexed::setTexture(const TextureRegion& sheet)
 {
-	sf::Sprite::setTexture(texture);
-
-	if (width_ < 1 || width_ > widthLimit())
-    {
-		width_ = widthLimit();
-    }
-
-	if (height_ < 1 || height_ > heightLimit())
-    {
-		height_ = heightLimit();
-    }
-
-	if (index_ > getIndexLimit())
-    {
-		index_ = getIndexLimit();
-    }
+	setSheet(SpriteSheet::get(sheet, getWidth(), getHeight(), sheet_->getDirections()));
 }
 
 //----------------------------------------------------------------------------
-// - Get Index Limit
+// - Get Sprite Sheet
 //----------------------------------------------------------------------------
-// Computes the maximum possible index given the width and height of a frame
-// and the size of the source texture
+// Returns the shared sheet, on which animation clips may be defined
 //----------------------------------------------------------------------------
-int SpriteIndexed::getIndexLimit() const
+SpriteSheet& SpriteIndexed::getSheet()
 {
-	if (!getTexture())
-		return 0;
+	return *sheet_;
+}
 
-	return (getTexture()->getSize().x / width_) * (getTexture()->getSize().y / height_);
+//----------------------------------------------------------------------------
+// - Get Sprite Sheet (Constant)
+//----------------------------------------------------------------------------
+const SpriteSheet& SpriteIndexed::getSheet() const
+{
+	return *sheet_;
 }
 
 //----------------------------------------------------------------------------
-// - Get Width Limit
+// - Get Index Limit
 //----------------------------------------------------------------------------
-// Computes the maximum possible width of a frame from the source texture
+// Returns the number of frames in the sheet, in a single direction
 //----------------------------------------------------------------------------
-int SpriteIndexed::widthLimit() const
+int SpriteIndexed::getIndexLimit() const
 {
-	if (!getTexture())
-		return 0;
-
-	return getTexture()->getSize().x;
+	return sheet_->getFrames();
 }
 
 //----------------------------------------------------------------------------
-// - Get Height Limit
+// - Set Sprite Sheet (protected)
 //----------------------------------------------------------------------------
-// Computes the maximum possible height of a frame from the source texture
+// * sheet : shared sprite sheet to display the frames of, keeping the index
+//      if the sheet has that many frames
 //----------------------------------------------------------------------------
-int SpriteIndexed::heightLimit() const
+void SpriteIndexed::setSheet(SpriteSheet& sheet)
 {
-	if (!getTexture())
-		return 0;
+	sheet_ = &sheet;
+
+	if (sheet.getRegion().getTexture())
+    {
+		sf::Sprite::setTexture(*sheet.getRegion().getTexture());
+    }
 
-	return getTexture()->getSize().y;
+	if (index_ >= getIndexLimit())
+    {
+		index_ = 0;
+    }
+
+	updateFrame();
 }
 
 //----------------------------------------------------------------------------
 // - Update Texture Sub-Rectangle
 //----------------------------------------------------------------------------
-// Sets the sprite's texture sub-rectangle to the frame located at the given
-// index, counting left -> right, then top -> bottom (row)
+// Sets the sprite's texture sub-rectangle to the sheet's frame at the index.
+// Empty sheets, as in headless simulations, have no frames to show
 //----------------------------------------------------------------------------
 void SpriteIndexed::updateFrame()
 {
-	int xTiles = getTexture()->getSize().x / width_;
-	sf::Sprite::setTextureRect(sf::IntRect(width_ * (index_ % xTiles), height_ * (index_ / xTiles), width_, height_));
+	if (sheet_->getFrames() == 0)
+		return;
+
+	sf::Sprite::setTextureRect(sheet_->frame(index_));
+	RedrawTracker::instance().request();
 }
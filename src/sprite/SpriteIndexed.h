@@ -2,17 +2,22 @@
 #define TACTICS_SPRITE_INDEXED_H
 
 #include <SFML/Graphics.hpp>
+#include "TextureRegion.h"
+#include "SpriteSheet.h"
 
 //================================================================================
 // ** Sprite Indexed
 //================================================================================
-// A sprite which allows for indexed sub-frames
+// A sprite which allows for indexed sub-frames of a sheet, which may be a region
+// of a larger texture such as an atlas page. Frames are looked up in a shared
+// sprite sheet, so changing frames costs no arithmetic
 //================================================================================
 class SpriteIndexed : public sf::Sprite
 {
 // Methods
 public:
-	SpriteIndexed(const sf::Texture& texture, int width = 0, int height = 0);
+	SpriteIndexed(const TextureRegion& sheet, int width = 0, int height = 0);
+	SpriteIndexed(SpriteSheet& sheet);
 	virtual ~SpriteIndexed();
 
 	int				        getIndex() const;
@@ -21,18 +26,18 @@ public:
 	void			        setIndex(int index);
 	void			        setWidth(int width);
 	void			        setHeight(int height);
-	void			        setTexture(const sf::Texture& texture);
-	virtual int		        getIndexLimit() const;
+	void			        setTexture(const TextureRegion& sheet);
+	SpriteSheet&	        getSheet();
+	const SpriteSheet&      getSheet() const;
+	int		                getIndexLimit() const;
 
 protected:
-	virtual int		        widthLimit() const;
-	virtual int		        heightLimit() const;
+	void			        setSheet(SpriteSheet& sheet);
 	virtual void	        updateFrame();
 
 // Members
+	SpriteSheet*	        sheet_;
 	int				        index_;
-	int				        width_;
-	int				        height_;
 
     // Undefined for Indexed sprites.
 	void			        setTextureRect(const sf::IntRect& rectangle) {}
@@ -1,9 +1,10 @@
 #include "SpriteMenuFrame.h"
+#include "../game/DrawList.h"
 #include <iostream>
 //----------------------------------------------------------------------------
 // - Sprite Menu Frame Constructor
 //----------------------------------------------------------------------------
-// * texture : bitmap image used for the outer frame sprites
+// * texture : bitmap image, or region of one, used for the outer frame sprites
 // * size : size of the inner body of the frame
 // Frame piece order (in array and expected in texture):
 //      top-left
@@ -15,7 +16,7 @@
 //      top
 //      bottom
 //----------------------------------------------------------------------------
-SpriteMenuFrame::SpriteMenuFrame(const sf::Texture& texture, sf::Vector2u size) :
+SpriteMenuFrame::SpriteMenuFrame(const TextureRegion& texture, sf::Vector2u size) :
     frame_(0),
     width_x(0),
     width_y(0)
@@ -28,8 +29,8 @@ SpriteMenuFrame::SpriteMenuFrame(const sf::Texture& texture, sf::Vector2u size)
 
         for(int i = 0; i < 8; i++)
         {
-            frame_[i].setTexture(texture);
-            frame_[i].setTextureRect(sf::IntRect(width_x * (i % 4), width_y * (i / 4), width_x, width_y));
+            frame_[i].setTexture(*texture.getTexture());
+            frame_[i].setTextureRect(texture.sub(sf::IntRect(width_x * (i % 4), width_y * (i / 4), width_x, width_y)));
         }
 
         setSize(size);
@@ -65,6 +66,12 @@ void SpriteMenuFrame::setSize(const sf::Vector2u& size)
     {
         size_.y = 1;
     }
+
+    // Frames too small to split, as in headless simulations, have no pieces
+    if(!frame_)
+    {
+        return;
+    }
     
     // Top-left Corner
     frame_[0].setPosition(-1 * width_x, -1 * width_y);        
@@ -100,6 +107,8 @@ sf::FloatRect SpriteMenuFrame::getGlobalBounds() const
         sf::FloatRect rect(frame_[0].getPosition(), sf::Vector2f(frame_[5].getPosition().x + width_x * 2, frame_[5].getPosition().y + width_y * 2));
         return getTransform().transformRect(rect);
     }
+
+    return getTransform().transformRect(sf::FloatRect(0, 0, size_.x, size_.y));
 }
 
 
@@ -114,7 +123,7 @@ void SpriteMenuFrame::draw(sf::RenderTarget& target, sf::RenderStates states) co
         states.transform *= getTransform();
         for(int i = 0; i < 8; i++)
         {
-            target.draw(frame_[i], states);
+            DrawList::submit(target, frame_[i], states);
         }
     }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "Sprite.h"
+#include "TextureRegion.h"
 
 //================================================================================
 // ** Sprite Menu Frame
@@ -13,7 +14,7 @@ class SpriteMenuFrame : public Sprite
 {
 // Methods
 public:
-    SpriteMenuFrame(const sf::Texture& texture, sf::Vector2u size = sf::Vector2u(32, 32));
+    SpriteMenuFrame(const TextureRegion& texture, sf::Vector2u size = sf::Vector2u(32, 32));
     ~SpriteMenuFrame();
 
     void                    setSize(const sf::Vector2u& size);
@@ -0,0 +1,163 @@
+#include "SpriteSheet.h"
+
+std::vector<SpriteSheet*> SpriteSheet::sheets_;
+
+//----------------------------------------------------------------------------
+// - Sprite Sheet Constructor (private)
+//----------------------------------------------------------------------------
+// * region : bitmap, or region of one, cut into frames
+// * width, height : size in pixels of a single frame, within the region
+// * directions : number of rows of directions the frames are split into
+// Lays out the rectangle of every frame, counting left -> right, then
+// top -> bottom, each direction following the last one's frames
+//----------------------------------------------------------------------------
+SpriteSheet::SpriteSheet(const TextureRegion& region, int width, int height, int directions) :
+    region_(region),
+    width_(width),
+    height_(height),
+    directions_(directions),
+    frames_(0)
+{
+    const sf::IntRect& rect = region_.getRect();
+
+    if(width_ < 1 || height_ < 1)
+    {
+        return;
+    }
+
+    int xTiles = rect.width / width_;
+    frames_ = xTiles * (rect.height / height_) / directions_;
+    rects_.resize(frames_ * directions_);
+
+    for(int i = 0; i < rects_.size(); i++)
+    {
+        rects_[i] = region_.sub(sf::IntRect(width_ * (i % xTiles), height_ * (i / xTiles), width_, height_));
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Sheet
+//----------------------------------------------------------------------------
+// * region : bitmap, or region of one, cut into frames
+// * width : width in pixels of a single frame, or 0 for the whole region
+// * height : height in pixels of a single frame, or 0 for a whole direction
+// * directions : rows of directions to split the region into. An empty
+//      region takes any number, so facing is kept even without graphics
+// Returns the sheet cutting the region this way, creating it the first time
+//----------------------------------------------------------------------------
+SpriteSheet& SpriteSheet::get(const TextureRegion& region, int width, int height, int directions)
+{
+    const sf::IntRect& rect = region.getRect();
+
+    if(directions < 1 || (rect.height > 0 && directions > rect.height))
+    {
+        directions = 1;
+    }
+
+    if(width < 1 || width > rect.width)
+    {
+        width = rect.width;
+    }
+
+    if(height < 1 || height > rect.height / directions)
+    {
+        height = rect.height / directions;
+    }
+
+    for(SpriteSheet* sheet : sheets_)
+    {
+        if(sheet->region_.getTexture() == region.getTexture() && sheet->region_.getRect() == rect &&
+            sheet->width_ == width && sheet->height_ == height && sheet->directions_ == directions)
+        {
+            return *sheet;
+        }
+    }
+
+    sheets_.push_back(new SpriteSheet(region, width, height, directions));
+
+    return *sheets_.back();
+}
+
+//----------------------------------------------------------------------------
+// - Get Texture Region
+//----------------------------------------------------------------------------
+const TextureRegion& SpriteSheet::getRegion() const
+{
+    return region_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Width
+//----------------------------------------------------------------------------
+int SpriteSheet::getWidth() const
+{
+    return width_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Height
+//----------------------------------------------------------------------------
+int SpriteSheet::getHeight() const
+{
+    return height_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Directions
+//----------------------------------------------------------------------------
+int SpriteSheet::getDirections() const
+{
+    return directions_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Count
+//----------------------------------------------------------------------------
+// Returns the number of frames in each direction, 0 for an empty region
+//----------------------------------------------------------------------------
+int SpriteSheet::getFrames() const
+{
+    return frames_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Frame Rectangle
+//----------------------------------------------------------------------------
+// * index : frame within the direction, in [0, frames)
+// * direction : row of directions, in [0, directions)
+// Returns the frame's rectangle in texture coordinates
+//----------------------------------------------------------------------------
+const sf::IntRect& SpriteSheet::frame(int index, int direction) const
+{
+    return rects_[direction * frames_ + index];
+}
+
+//----------------------------------------------------------------------------
+// - Add Animation Clip
+//----------------------------------------------------------------------------
+// * name : name identifying the clip within the sheet
+// * sequence : frame indices played in order
+// Clips already defined are kept as they are, so every sprite sharing the
+// sheet may define the clips it needs without copying them
+//----------------------------------------------------------------------------
+void SpriteSheet::addClip(const std::string& name, const std::vector<int>& sequence)
+{
+    if(!sequence.empty() && name != "")
+    {
+        clips_.insert(std::make_pair(name, sequence));
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Animation Clip
+//----------------------------------------------------------------------------
+// * name : name of the clip
+// Returns the clip's sequence, which stays in place for the life of the
+// sheet, or null if there is none of this name
+//----------------------------------------------------------------------------
+const std::vector<int>* SpriteSheet::getClip(const std::string& name) const
+{
+    auto clip = clips_.find(name);
+
+    return clip != clips_.end() ? &clip->second : 0;
+}
\ No newline at end of file
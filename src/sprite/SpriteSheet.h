@@ -0,0 +1,52 @@
+#ifndef TACTICS_SPRITE_SHEET_H
+#define TACTICS_SPRITE_SHEET_H
+
+#include <SFML/Graphics.hpp>
+#include "TextureRegion.h"
+#include <map>
+#include <string>
+#include <vector>
+
+//================================================================================
+// ** Sprite Sheet
+//================================================================================
+// Shared description of a texture region split into a grid of equally sized
+// frames, in rows of directions, with the rectangle of every frame computed
+// once up front. Named animation clips of frame indices are kept alongside,
+// each name bound to its first sequence. Sheets are interned: every sprite
+// cutting the same region the same way references the same sheet, which
+// lives as long as the program and never changes its frames
+//================================================================================
+class SpriteSheet
+{
+// Methods
+private:
+    SpriteSheet(const TextureRegion& region, int width, int height, int directions);
+    SpriteSheet(const SpriteSheet& copy);
+
+public:
+    static SpriteSheet&         get(const TextureRegion& region, int width = 0, int height = 0, int directions = 1);
+
+    const TextureRegion&        getRegion() const;
+    int                         getWidth() const;
+    int                         getHeight() const;
+    int                         getDirections() const;
+    int                         getFrames() const;
+    const sf::IntRect&          frame(int index, int direction = 0) const;
+    void                        addClip(const std::string& name, const std::vector<int>& sequence);
+    const std::vector<int>*     getClip(const std::string& name) const;
+
+// Members
+private:
+    static std::vector<SpriteSheet*> sheets_;
+
+    TextureRegion               region_;
+    int                         width_;
+    int                         height_;
+    int                         directions_;
+    int                         frames_;
+    std::vector<sf::IntRect>    rects_;
+    std::map<std::string, std::vector<int>> clips_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "TextLabel.h"
+#include "../game/DrawList.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+// - Text Label Constructor
+//----------------------------------------------------------------------------
+// * size : character size in pixels
+// * bold : whether the label is emboldened
+//----------------------------------------------------------------------------
+TextLabel::TextLabel(unsigned size, bool bold) :
+    size_(size),
+    face_(&GlyphAtlas::instance().face(size, bold)),
+    vertices_(sf::Quads),
+    pens_(1, 0),
+    color_(sf::Color::White)
+{}
+
+//----------------------------------------------------------------------------
+// - Text Label Constructor (String)
+//----------------------------------------------------------------------------
+// * string : single line of text to display
+// * size : character size in pixels
+// * bold : whether the label is emboldened
+//----------------------------------------------------------------------------
+TextLabel::TextLabel(const std::string& string, unsigned size, bool bold) :
+    TextLabel(size, bold)
+{
+    setString(string);
+}
+
+//----------------------------------------------------------------------------
+// - Text Label Destructor
+//----------------------------------------------------------------------------
+TextLabel::~TextLabel()
+{}
+
+//----------------------------------------------------------------------------
+// - Get String
+//----------------------------------------------------------------------------
+const std::string& TextLabel::getString() const
+{
+    return string_;
+}
+
+//----------------------------------------------------------------------------
+// - Set String
+//----------------------------------------------------------------------------
+// * string : single line of text to display
+// Only characters from the first one that differs are laid out again
+//----------------------------------------------------------------------------
+void TextLabel::setString(const std::string& string)
+{
+    int from = 0;
+    int common = std::min(string.size(), string_.size());
+
+    while(from < common && string[from] == string_[from])
+    {
+        from++;
+    }
+
+    if(from == common && string.size() == string_.size())
+    {
+        return;
+    }
+
+    string_ = string;
+    layout(from);
+}
+
+//----------------------------------------------------------------------------
+// - Is Bold?
+//----------------------------------------------------------------------------
+bool TextLabel::isBold() const
+{
+    return face_->bold;
+}
+
+//----------------------------------------------------------------------------
+// - Set Bold
+//----------------------------------------------------------------------------
+// * bold : whether the label is emboldened, laying it out again if changed
+//----------------------------------------------------------------------------
+void TextLabel::setBold(bool bold)
+{
+    if(bold != face_->bold)
+    {
+        face_ = &GlyphAtlas::instance().face(size_, bold);
+        layout(0);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Color
+//----------------------------------------------------------------------------
+const sf::Color& TextLabel::getColor() const
+{
+    return color_;
+}
+
+//----------------------------------------------------------------------------
+// - Set Color
+//----------------------------------------------------------------------------
+// * color : fill color of the label's characters
+//----------------------------------------------------------------------------
+void TextLabel::setColor(const sf::Color& color)
+{
+    color_ = color;
+
+    for(int i = 0; i < vertices_.getVertexCount(); i++)
+    {
+        vertices_[i].color = color;
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Get Local Bounding Rectangle
+//----------------------------------------------------------------------------
+// Returns the rectangle the label's visible glyphs inscribe
+//----------------------------------------------------------------------------
+sf::FloatRect TextLabel::getLocalBounds() const
+{
+    return bounds_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Global Bounding Rectangle
+//----------------------------------------------------------------------------
+sf::FloatRect TextLabel::getGlobalBounds() const
+{
+    return getTransform().transformRect(bounds_);
+}
+
+//----------------------------------------------------------------------------
+// - Draw (Override)
+//----------------------------------------------------------------------------
+void TextLabel::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if(vertices_.getVertexCount() > 0)
+    {
+        states.transform *= getTransform();
+        states.texture = &GlyphAtlas::instance().getTexture();
+        DrawList::submit(target, vertices_, states);
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Lay Out Glyphs (protected)
+//----------------------------------------------------------------------------
+// * from : first character whose quad is rebuilt; the pen position there only
+//      depends on the characters before it, which are left as they were
+// Quads are grown by the glyph atlas' blank border, as sf::Text does, so
+// smoothed edges are not clipped. Blank characters get empty quads. The
+// bounds are then taken again over all visible glyphs
+//----------------------------------------------------------------------------
+void TextLabel::layout(int from)
+{
+    const float padding = 1;
+    float baseline = size_;
+
+    vertices_.resize(string_.size() * 4);
+    pens_.resize(string_.size() + 1);
+
+    for(int i = from; i < string_.size(); i++)
+    {
+        const sf::Glyph& glyph = face_->glyph(string_[i]);
+        float x = pens_[i] + (i > 0 ? GlyphAtlas::instance().kerning(*face_, string_[i - 1], string_[i]) : 0);
+        sf::Vertex* quad = &vertices_[i * 4];
+
+        if(glyph.textureRect.width > 0 && glyph.textureRect.height > 0)
+        {
+            float left = x + glyph.bounds.left - padding;
+            float top = baseline + glyph.bounds.top - padding;
+            float right = x + glyph.bounds.left + glyph.bounds.width + padding;
+            float bottom = baseline + glyph.bounds.top + glyph.bounds.height + padding;
+
+            float u1 = glyph.textureRect.left - padding;
+            float v1 = glyph.textureRect.top - padding;
+            float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
+            float v2 = glyph.textureRect.top + glyph.textureRect.height + padding;
+
+            quad[0] = sf::Vertex(sf::Vector2f(left, top), color_, sf::Vector2f(u1, v1));
+            quad[1] = sf::Vertex(sf::Vector2f(right, top), color_, sf::Vector2f(u2, v1));
+            quad[2] = sf::Vertex(sf::Vector2f(right, bottom), color_, sf::Vector2f(u2, v2));
+            quad[3] = sf::Vertex(sf::Vector2f(left, bottom), color_, sf::Vector2f(u1, v2));
+        }
+        else
+        {
+            for(int v = 0; v < 4; v++)
+            {
+                quad[v] = sf::Vertex(sf::Vector2f(x, baseline), color_);
+            }
+        }
+
+        pens_[i + 1] = x + glyph.advance;
+    }
+
+    // Bounds, excluding the quads' borders
+    float minX = 0, minY = 0, maxX = 0, maxY = 0;
+    bool empty = true;
+
+    for(int i = 0; i < string_.size(); i++)
+    {
+        const sf::Vertex* quad = &vertices_[i * 4];
+
+        if(quad[0].position == quad[2].position)
+        {
+            continue;
+        }
+
+        if(empty)
+        {
+            minX = quad[0].position.x + padding;
+            minY = quad[0].position.y + padding;
+            maxX = quad[2].position.x - padding;
+            maxY = quad[2].position.y - padding;
+            empty = false;
+        }
+        else
+        {
+            minX = std::min(minX, quad[0].position.x + padding);
+            minY = std::min(minY, quad[0].position.y + padding);
+            maxX = std::max(maxX, quad[2].position.x - padding);
+            maxY = std::max(maxY, quad[2].position.y - padding);
+        }
+    }
+
+    bounds_ = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef TACTICS_TEXT_LABEL_H
+#define TACTICS_TEXT_LABEL_H
+
+#include <SFML/Graphics.hpp>
+#include "../game/GlyphAtlas.h"
+#include <string>
+#include <vector>
+
+//================================================================================
+// ** Text Label
+//================================================================================
+// Lightweight single line of text set in a face of the shared glyph atlas, one
+// quad per character in a single vertex array. Changing the string lays out
+// again only from the first changed character, and reuses the label's storage,
+// so updates of the same or a shorter length never allocate. Like sf::Text, the
+// baseline sits one character size below the label's position
+//================================================================================
+class TextLabel : public sf::Drawable, public sf::Transformable
+{
+// Methods
+public:
+    TextLabel(unsigned size = 16, bool bold = false);
+    TextLabel(const std::string& string, unsigned size = 16, bool bold = false);
+    virtual ~TextLabel();
+
+    const std::string&      getString() const;
+    void                    setString(const std::string& string);
+    bool                    isBold() const;
+    void                    setBold(bool bold);
+    const sf::Color&        getColor() const;
+    void                    setColor(const sf::Color& color);
+    sf::FloatRect           getLocalBounds() const;
+    sf::FloatRect           getGlobalBounds() const;
+
+protected:
+    virtual void            draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    void                    layout(int from);
+
+// Members
+    std::string             string_;
+    unsigned                size_;
+    const GlyphAtlas::Face* face_;
+    sf::VertexArray         vertices_;
+    std::vector<float>      pens_;
+    sf::Color               color_;
+    sf::FloatRect           bounds_;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "TextureRegion.h"
+
+//----------------------------------------------------------------------------
+// - Texture Region Constructor (Empty)
+//----------------------------------------------------------------------------
+TextureRegion::TextureRegion() :
+    texture_(0)
+{}
+
+//----------------------------------------------------------------------------
+// - Texture Region Constructor (Whole Texture)
+//----------------------------------------------------------------------------
+// * texture : texture whose entire area makes up the region
+//----------------------------------------------------------------------------
+TextureRegion::TextureRegion(const sf::Texture& texture) :
+    texture_(&texture),
+    rect_(0, 0, texture.getSize().x, texture.getSize().y)
+{}
+
+//----------------------------------------------------------------------------
+// - Texture Region Constructor
+//----------------------------------------------------------------------------
+// * texture : texture the region lies within
+// * rect : bounds of the region in the texture, in pixels
+//----------------------------------------------------------------------------
+TextureRegion::TextureRegion(const sf::Texture& texture, const sf::IntRect& rect) :
+    texture_(&texture),
+    rect_(rect)
+{}
+
+//----------------------------------------------------------------------------
+// - Get Texture
+//----------------------------------------------------------------------------
+const sf::Texture* TextureRegion::getTexture() const
+{
+    return texture_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Bounding Rectangle
+//----------------------------------------------------------------------------
+const sf::IntRect& TextureRegion::getRect() const
+{
+    return rect_;
+}
+
+//----------------------------------------------------------------------------
+// - Get Size
+//----------------------------------------------------------------------------
+sf::Vector2u TextureRegion::getSize() const
+{
+    return sf::Vector2u(rect_.width, rect_.height);
+}
+
+//----------------------------------------------------------------------------
+// - Covers Whole Texture?
+//----------------------------------------------------------------------------
+// Only regions spanning their entire texture may rely on it repeating
+//----------------------------------------------------------------------------
+bool TextureRegion::whole() const
+{
+    return texture_ && rect_.left == 0 && rect_.top == 0 &&
+        rect_.width == int(texture_->getSize().x) && rect_.height == int(texture_->getSize().y);
+}
+
+//----------------------------------------------------------------------------
+// - Sub-Rectangle
+//----------------------------------------------------------------------------
+// * rect : rectangle relative to the top left of the region
+// Returns the rectangle in texture coordinates
+//----------------------------------------------------------------------------
+sf::IntRect TextureRegion::sub(const sf::IntRect& rect) const
+{
+    return sf::IntRect(rect_.left + rect.left, rect_.top + rect.top, rect.width, rect.height);
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef TACTICS_TEXTURE_REGION_H
+#define TACTICS_TEXTURE_REGION_H
+
+#include <SFML/Graphics.hpp>
+
+//================================================================================
+// ** Texture Region
+//================================================================================
+// Handle to a sub-rectangle of a texture, such as one image packed into a
+// texture atlas. A whole texture converts implicitly to a region covering it
+//================================================================================
+class TextureRegion
+{
+// Methods
+public:
+    TextureRegion();
+    TextureRegion(const sf::Texture& texture);
+    TextureRegion(const sf::Texture& texture, const sf::IntRect& rect);
+
+    const sf::Texture*  getTexture() const;
+    const sf::IntRect&  getRect() const;
+    sf::Vector2u        getSize() const;
+    bool                whole() const;
+    sf::IntRect         sub(const sf::IntRect& rect) const;
+
+// Members
+private:
+    const sf::Texture*  texture_;
+    sf::IntRect         rect_;
+};
+
+#endif
\ No newline at end of file
@@ -1,55 +1,54 @@
 #include <algorithm>
 #include "SpriteTile.h"
+#include "../../game/DrawList.h"
 
 //----------------------------------------------------------------------------
 // - Tile Sprite Contructor
 //----------------------------------------------------------------------------
-// * texture : the bitmap containing the image data for the tile.
+// * sheet : the bitmap, or region of one, containing the image data for the tile.
 // * width : width in pixels; 0 to fit automatically to texture
 // * length : width in pixels; 0 to fit automatically to texture
 // * height : height in pixels
 // * continuous : TRUE if the tile's sprite continues infinitely downward
 //----------------------------------------------------------------------------
-SpriteTile::SpriteTile(const sf::Texture& texture, float width, float length, float height, bool continuous) :
+SpriteTile::SpriteTile(const TextureRegion& sheet, float width, float length, float height, bool continuous) :
     Sprite(),
-    top_(new sf::Sprite(texture)),
-    body_(0),
+    top_(new sf::Sprite(*sheet.getTexture())),
+    body_(sf::Quads),
     bottom_(0),
     width_(width),
     length_(length),
     height_(std::max(height, 0.f)),    
-    continuous_(continuous)
+    continuous_(continuous),
+    sheet_(sheet)
 {
-    if(width <= 0 || width > texture.getSize().x / 2)
+    if(width <= 0 || width > sheet.getSize().x / 2)
     {
-        width_ = texture.getSize().x / 2;
+        width_ = sheet.getSize().x / 2;
     }
 
-    if(length <= 0 || length > texture.getSize().y / 2)
+    if(length <= 0 || length > sheet.getSize().y / 2)
     {
-        length_ = texture.getSize().y / 2;
+        length_ = sheet.getSize().y / 2;
     }
 
-    const_cast<sf::Texture&>(texture).setRepeated(true);
+    if(sheet.whole())
+    {
+        const_cast<sf::Texture*>(sheet.getTexture())->setRepeated(true);
+    }
 
     // Top
-    top_->setTextureRect(sf::IntRect(0, 0, width_, length_));
+    top_->setTextureRect(sheet.sub(sf::IntRect(0, 0, width_, length_)));
     top_->setPosition(-1 * width_ / 2, -1 * length_ / 2 - height_);
 
     // Body
-    if(height_ > 0 || continuous_)
-    {
-        body_ = new sf::Sprite(texture);
-        body_->setPosition(-1 * width_ / 2, -1 * height_);
-        int body_height = (continuous_ ? texture.getMaximumSize() : height_);
-        body_->setTextureRect(sf::IntRect(width_, 0, width_, body_height));
-    }
+    buildBody();
 
     // Bottom
     if(!continuous_)
     {
-        bottom_ = new sf::Sprite(texture);
-        bottom_->setTextureRect(sf::IntRect(0, length_, width_, length_));
+        bottom_ = new sf::Sprite(*sheet.getTexture());
+        bottom_->setTextureRect(sheet.sub(sf::IntRect(0, length_, width_, length_)));
         bottom_->setPosition(-1 * width_ / 2, -1 * length_ / 2);        
     }
 }
@@ -61,10 +60,6 @@ SpriteTile::~SpriteTile()
 {
     delete top_;
     
-    if(body_)
-    {
-        delete body_;
-    }
     if(bottom_)
     {
         delete bottom_;
@@ -83,22 +78,38 @@ void SpriteTile::resetHeight(float height)
 
     top_->setPosition(-1 * width_ / 2, -1 * length_ / 2 - height_);
 
-    // Body
-    if(height_ > 0 || continuous_)
+    buildBody();
+}
+
+//----------------------------------------------------------------------------
+// - Build Body (protected)
+//----------------------------------------------------------------------------
+// Lays out the body column below the top face. A whole texture repeats, so
+// one quad spans the column; a region is stacked one strip per quad
+//----------------------------------------------------------------------------
+void SpriteTile::buildBody()
+{
+    body_.clear();
+
+    if((height_ <= 0 && !continuous_) || sheet_.getSize().y < 1)
     {
-        if(!body_)
-        {
-            body_ = new sf::Sprite(*top_->getTexture());
-        }
-
-        body_->setPosition(-1 * width_ / 2, -1 * height_);
-        int body_height = (continuous_ ? top_->getTexture()->getMaximumSize() : height_);
-        body_->setTextureRect(sf::IntRect(width_, 0, width_, body_height));
+        return;
     }
-    else if(body_)
+
+    int body_height = (continuous_ ? sf::Texture::getMaximumSize() : height_);
+    int span = sheet_.whole() ? body_height : sheet_.getSize().y;
+    sf::IntRect strip = sheet_.sub(sf::IntRect(width_, 0, width_, span));
+
+    for(int y = 0; y < body_height; y += span)
     {
-        delete body_;
-        body_ = 0;
+        float top = -1 * height_ + y;
+        float left = -1 * width_ / 2;
+        int piece = std::min(span, body_height - y);
+
+        body_.append(sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(strip.left, strip.top)));
+        body_.append(sf::Vertex(sf::Vector2f(left + width_, top), sf::Vector2f(strip.left + width_, strip.top)));
+        body_.append(sf::Vertex(sf::Vector2f(left + width_, top + piece), sf::Vector2f(strip.left + width_, strip.top + piece)));
+        body_.append(sf::Vertex(sf::Vector2f(left, top + piece), sf::Vector2f(strip.left, strip.top + piece)));
     }
 }
 
@@ -111,9 +122,9 @@ sf::FloatRect SpriteTile::getGlobalBounds() const
 {
     sf::FloatRect bounds(top_->getGlobalBounds());
 
-    if(body_)
+    if(body_.getVertexCount() > 0)
     {
-        bounds.height += body_->getGlobalBounds().height;
+        bounds.height += body_.getBounds().height;
     }
 
     return bounds;
@@ -128,13 +139,15 @@ void SpriteTile::draw(sf::RenderTarget& target, sf::RenderStates states) const
 
     if(bottom_)
     {
-        target.draw(*bottom_, states);
+        DrawList::submit(target, *bottom_, states);
     }
 
-    if(body_)
+    if(body_.getVertexCount() > 0)
     {
-        target.draw(*body_, states);
+        sf::RenderStates bodyStates(states);
+        bodyStates.texture = sheet_.getTexture();
+        DrawList::submit(target, body_, bodyStates);
     }
 
-    target.draw(*top_, states);
+    DrawList::submit(target, *top_, states);
 }
\ No newline at end of file
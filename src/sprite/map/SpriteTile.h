@@ -3,16 +3,19 @@
 
 #include <SFML/Graphics.hpp>
 #include "../Sprite.h"
+#include "../TextureRegion.h"
 
 //================================================================================
 // ** SpriteTile
 //================================================================================
-// A sprite of a single (continuous or discrete) tile column.
+// A sprite of a single (continuous or discrete) tile column. The column's body
+// repeats the sheet's body strip, stacked as quads of a vertex array when the
+// sheet is a region of a larger texture, as only whole textures can repeat.
 //================================================================================
 class SpriteTile : public Sprite{
 // Methods
 public:
-    SpriteTile(const sf::Texture&, float width = 0, float length = 0, float height = 0, bool continuous = false);
+    SpriteTile(const TextureRegion&, float width = 0, float length = 0, float height = 0, bool continuous = false);
     virtual ~SpriteTile();
 
     sf::FloatRect   getGlobalBounds() const;
@@ -20,14 +23,16 @@ public:
 
 protected:
     void            draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    void            buildBody();
 
 // Members
     float           width_;
     float           length_;
     float           height_;
     bool            continuous_;
+    TextureRegion   sheet_;
     sf::Sprite*     top_;
-    sf::Sprite*     body_;
+    sf::VertexArray body_;
     sf::Sprite*     bottom_;
 };
 
@@ -0,0 +1,130 @@
+// Animations registry benchmark: registration, per-frame update with all
+// objects awake (serial and parallel) and all asleep, and de-registration
+// costs with 100k animated objects. Build with ../game/Animations.cpp,
+// ../game/ThreadPool.cpp, ../game/Signal.cpp, ../objects/AnimatedObject.cpp,
+// -pthread and the sfml libs
+#include "../game/Animations.h"
+#include "../game/ThreadPool.h"
+#include "../objects/AnimatedObject.h"
+#include <SFML/System.hpp>
+#include <iostream>
+#include <algorithm>
+#include <stdlib.h>
+
+//================================================================================
+// ** Counter
+//================================================================================
+// Minimal concurrent animated object counting its steps, with a little work
+// standing in for a frame advance
+//================================================================================
+class Counter : public AnimatedObject
+{
+public:
+    Counter(float fps) : AnimatedObject(fps), steps_(0), value_(1) {setConcurrent(true);}
+    long steps() const {return steps_;}
+    unsigned value() const {return value_;}
+    void rest() {sleep();}
+
+protected:
+    virtual void step()
+    {
+        for(int i = 0; i < 16; i++)
+        {
+            value_ = value_ * 1103515245 + 12345;
+        }
+        steps_++;
+    }
+
+    long steps_;
+    unsigned value_;
+};
+
+int main()
+{
+    const int count = 100000;
+    const int frames = 600;
+    const float rates[] = {FPS, FPS / 6, 10, 1};
+
+    srand(1);
+
+    std::vector<Counter*> objects(count);
+    sf::Clock timer;
+
+    // Registration
+    timer.restart();
+    for(int i = 0; i < count; i++)
+    {
+        objects[i] = new Counter(rates[i % 4]);
+    }
+    float registration = timer.restart().asMicroseconds();
+
+    // Updates at a steady frame rate, serial then parallel
+    Animations::instance().setParallel(false);
+    for(int f = 0; f < frames; f++)
+    {
+        Animations::instance().update(1 / FPS);
+    }
+    float updates = timer.restart().asMicroseconds();
+
+    long steps = 0;
+    for(Counter* object : objects)
+    {
+        steps += object->steps();
+    }
+
+    Animations::instance().setParallel(true);
+    timer.restart();
+    for(int f = 0; f < frames; f++)
+    {
+        Animations::instance().update(1 / FPS);
+    }
+    float parallel = timer.restart().asMicroseconds();
+
+    long parallelSteps = -steps;
+    for(Counter* object : objects)
+    {
+        parallelSteps += object->steps();
+    }
+
+    // Updates during a quiet turn, with every object asleep
+    for(Counter* object : objects)
+    {
+        object->rest();
+    }
+    int active = Animations::instance().active();
+
+    timer.restart();
+    for(int f = 0; f < frames; f++)
+    {
+        Animations::instance().update(1 / FPS);
+    }
+    float quiet = timer.restart().asMicroseconds();
+
+    // Waking every object restores it to the update
+    for(Counter* object : objects)
+    {
+        object->wake();
+    }
+    int woken = Animations::instance().active();
+
+    // De-registration in random order
+    std::random_shuffle(objects.begin(), objects.end());
+
+    timer.restart();
+    for(Counter* object : objects)
+    {
+        delete object;
+    }
+    float deregistration = timer.restart().asMicroseconds();
+
+    std::cout << count << " objects in " << Animations::instance().buckets() << " rate buckets, " << frames << " frames, " << steps << " steps" << std::endl;
+    std::cout << "  register:   " << registration * 1000 / count << " ns/object" << std::endl;
+    std::cout << "  serial:     " << updates / frames << " us/frame, " << updates * 1000 / steps << " ns/step" << std::endl;
+    std::cout << "  parallel:   " << parallel / frames << " us/frame, " << parallel * 1000 / parallelSteps << " ns/step, " << ThreadPool::instance().size() << " threads" << std::endl;
+    std::cout << "  quiet:      " << quiet / frames << " us/frame, " << active << " awake" << std::endl;
+    std::cout << "  woken:      " << woken << " awake" << std::endl;
+    std::cout << "  deregister: " << deregistration * 1000 / count << " ns/object" << std::endl;
+    std::cout << "  remaining:  " << Animations::instance().size() << std::endl;
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+// Coverage batch benchmark: reach and threat for 2 to 500 actors, serial
+// against parallel. Exits non-zero if the parallel per-team grids differ from
+// the serial ones. Build alongside the map, object, sprite, screen, control,
+// skill and game sources (excluding the mains) with -pthread, -std=c++20 and
+// the sfml libs
+#include "../map/Map.h"
+#include "../map/Tile.h"
+#include "../objects/Actor.h"
+#include "../game/Coverage.h"
+#include "../game/ThreadPool.h"
+#include "../player/skill/SkillAttack.h"
+#include <iostream>
+#include <iomanip>
+#include <stdlib.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------
+// - Grids Equal?
+//----------------------------------------------------------------------------
+static bool equal(const BitGrid& a, const BitGrid& b)
+{
+    if(a.width() != b.width() || a.height() != b.height())
+    {
+        return false;
+    }
+
+    for(int y = 0; y < a.height(); y++)
+    {
+        if(memcmp(a.row(y), b.row(y), a.stride() * sizeof(uint64_t)) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    const int size = 128;
+    const int runs = 50;
+    const int counts[] = {2, 10, 50, 100, 250, 500};
+
+    srand(1);
+
+    sf::Texture texture;
+    texture.create(48, 48);
+
+    // Mostly filled map with scattered holes
+    Map map(size, size);
+    for(int x = 0; x < size; x++)
+    {
+        for(int y = 0; y < size; y++)
+        {
+            if(rand() % 10 != 0)
+            {
+                map.place(new Tile(0, 1), x, y);
+            }
+        }
+    }
+
+    int mismatches = 0;
+
+    std::cout << "threads: " << ThreadPool::instance().size() << std::endl;
+    std::cout << std::setw(8) << "actors" << std::setw(14) << "serial (us)" << std::setw(16) << "parallel (us)" << std::setw(10) << "speedup" << std::endl;
+
+    for(int count : counts)
+    {
+        std::vector<Actor*> actors;
+
+        while(actors.size() < count)
+        {
+            int x = rand() % size, y = rand() % size;
+
+            if(map.valid(x, y) && !map.playerAt(x, y))
+            {
+                Actor* actor = new Actor(texture, &map);
+                actor->setPosition(sf::Vector3f(x, y, map.height(x, y)));
+                actor->setMove(4 + rand() % 5);
+                actor->setTeam(actors.size() % 2);
+                map.enter(actor, x, y);
+                actors.push_back(actor);
+            }
+        }
+
+        Coverage serialCoverage, parallelCoverage;
+        sf::Clock timer;
+
+        timer.restart();
+        for(int i = 0; i < runs; i++)
+        {
+            serialCoverage.compute(map, actors, false);
+        }
+        float serial = timer.restart().asMicroseconds() / float(runs);
+
+        for(int i = 0; i < runs; i++)
+        {
+            parallelCoverage.compute(map, actors, true);
+        }
+        float parallel = timer.restart().asMicroseconds() / float(runs);
+
+        std::cout << std::setw(8) << count << std::setw(14) << serial << std::setw(16) << parallel << std::setw(10) << serial / parallel << std::endl;
+
+        // Both passes must merge into identical team grids
+        for(int team = 0; team < std::max(serialCoverage.teams(), parallelCoverage.teams()); team++)
+        {
+            if(team >= serialCoverage.teams() || team >= parallelCoverage.teams()
+                || !equal(serialCoverage.reach(team), parallelCoverage.reach(team))
+                || !equal(serialCoverage.threat(team), parallelCoverage.threat(team)))
+            {
+                std::cout << "  team " << team << " grids differ between serial and parallel" << std::endl;
+                mismatches++;
+            }
+        }
+
+        for(Actor* actor : actors)
+        {
+            map.exit(actor->position().x, actor->position().y);
+            delete actor;
+        }
+    }
+
+    std::cout << (mismatches ? "FAILED" : "OK") << std::endl;
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+// Particle benchmark: 50k live particles spread over 50 emitters, each topping
+// its pool up every frame as particles expire, stepped serially then in
+// parallel, and recorded into a draw list. Reports the cost of a frame against
+// the 60 FPS budget. Every emitter must be drawn with at most one draw call,
+// and empty out and sleep once emission stops. Build alongside the map,
+// object, sprite, screen, control, skill and game sources (excluding the
+// mains) with -pthread, -std=c++20 and the sfml libs
+#include "../objects/ParticleEmitter.h"
+#include "../game/DrawList.h"
+#include "../game/ThreadPool.h"
+#include <SFML/System.hpp>
+#include <iostream>
+
+int main()
+{
+    const int emitters = 50;
+    const int capacity = 1000;
+    const int frames = 600;
+    const float budget = 1000000 / FPS;
+
+    std::vector<ParticleEmitter*> pool(emitters);
+
+    for(int e = 0; e < emitters; e++)
+    {
+        pool[e] = new ParticleEmitter(capacity, e + 1);
+        pool[e]->setSpeed(20, 200);
+        pool[e]->setLifetime(0.5, 1.5);
+        pool[e]->setGravity(200);
+        pool[e]->setDrag(0.5);
+        pool[e]->setColors(sf::Color(255, 255, 0), sf::Color(255, 0, 0, 0));
+    }
+
+    DrawList list(sf::Vector2u(ASPECT_RATIO.x, ASPECT_RATIO.y));
+    sf::Clock timer;
+    long live = 0;
+
+    // Stepping at a steady frame rate, serial then parallel, refilling the
+    // pools before each frame
+    float stepping[2] = {0, 0}, emitting[2] = {0, 0};
+
+    for(int parallel = 0; parallel < 2; parallel++)
+    {
+        Animations::instance().setParallel(parallel);
+
+        for(int f = 0; f < frames; f++)
+        {
+            timer.restart();
+            for(ParticleEmitter* emitter : pool)
+            {
+                emitter->emit(capacity);
+            }
+            emitting[parallel] += timer.restart().asMicroseconds();
+
+            Animations::instance().update(1 / FPS);
+            stepping[parallel] += timer.restart().asMicroseconds();
+        }
+    }
+
+    // Recording, once the pools are full
+    float recording = 0;
+    unsigned long commands = 0;
+
+    for(int f = 0; f < frames; f++)
+    {
+        for(ParticleEmitter* emitter : pool)
+        {
+            emitter->emit(capacity);
+            live += emitter->live();
+        }
+
+        timer.restart();
+        list.reset();
+        for(ParticleEmitter* emitter : pool)
+        {
+            list.draw(*emitter);
+        }
+        recording += timer.restart().asMicroseconds();
+        commands += list.commands();
+
+        Animations::instance().update(1 / FPS);
+    }
+
+    // Fading out, longer than any particle lives
+    for(int f = 0; f < 2 * FPS; f++)
+    {
+        Animations::instance().update(1 / FPS);
+    }
+
+    int lingering = 0;
+    for(ParticleEmitter* emitter : pool)
+    {
+        lingering += emitter->live() > 0 || emitter->awake();
+    }
+
+    float frame = (emitting[1] + stepping[1] + recording) / frames;
+
+    std::cout << emitters << " emitters, " << live / frames << " live particles, " << frames << " frames" << std::endl;
+    std::cout << "  emit:     " << emitting[1] / frames << " us/frame" << std::endl;
+    std::cout << "  serial:   " << stepping[0] / frames << " us/frame, " << stepping[0] * 1000 / (frames * emitters * capacity) << " ns/particle" << std::endl;
+    std::cout << "  parallel: " << stepping[1] / frames << " us/frame, " << stepping[1] * 1000 / (frames * emitters * capacity) << " ns/particle, " << ThreadPool::instance().size() << " threads" << std::endl;
+    std::cout << "  record:   " << recording / frames << " us/frame, " << double(commands) / frames << " draw calls" << std::endl;
+    std::cout << "  frame:    " << frame << " us, " << frame * 100 / budget << "% of the " << FPS << " FPS budget" << std::endl;
+    std::cout << "  " << lingering << " lingering emitters" << std::endl;
+
+    for(ParticleEmitter* emitter : pool)
+    {
+        delete emitter;
+    }
+
+    return lingering > 0 || commands > (unsigned long)frames * emitters;
+}
\ No newline at end of file
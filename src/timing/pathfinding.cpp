@@ -0,0 +1,621 @@
+// Pathfinding benchmark and validation: checks Actor::reach, under both the
+// standard and custom rules, shortestPath and plan against a reference
+// breadth-first solver on generated maps, including their edges, then
+// reports queries per second and heap allocations per query, and plan query
+// and terrain edit repair times on a 1024x1024 map. Exits non-zero on any
+// mismatch. Build alongside the map, object, sprite, screen, control, skill
+// and game sources (excluding the mains) with -pthread, -std=c++20 and the
+// sfml libs
+#include "../map/Map.h"
+#include "../map/Tile.h"
+#include "../objects/Actor.h"
+#include <iostream>
+#include <iomanip>
+#include <queue>
+#include <set>
+#include <new>
+#include <stdlib.h>
+#include <math.h>
+
+//----------------------------------------------------------------------------
+// - Allocation Counting
+//----------------------------------------------------------------------------
+static unsigned long allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    allocations++;
+
+    void* memory = malloc(size ? size : 1);
+    if(!memory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    free(memory);
+}
+
+//----------------------------------------------------------------------------
+// - Map Generators
+//----------------------------------------------------------------------------
+// Each fills an empty map; heights are stacks of 1-unit tiles
+//----------------------------------------------------------------------------
+static void generateFlat(Map& map)
+{
+    for(int x = 0; x < map.width(); x++)
+    {
+        for(int y = 0; y < map.length(); y++)
+        {
+            map.place(new Tile(0, 1), x, y);
+        }
+    }
+}
+
+static void generateHeights(Map& map)
+{
+    for(int x = 0; x < map.width(); x++)
+    {
+        for(int y = 0; y < map.length(); y++)
+        {
+            int height = 1 + rand() % 4;
+
+            for(int h = 0; h < height; h++)
+            {
+                map.place(new Tile(0, 1), x, y);
+            }
+        }
+    }
+}
+
+static void generateMaze(Map& map)
+{
+    // Recursive backtracker over odd cells; walls are left without tiles
+    std::vector<sf::Vector2i> stack(1, sf::Vector2i(1, 1));
+    std::vector<bool> open(map.width() * map.length(), false);
+    const sf::Vector2i offsets[4] = {sf::Vector2i(2, 0), sf::Vector2i(0, 2), sf::Vector2i(-2, 0), sf::Vector2i(0, -2)};
+
+    open[map.width() + 1] = true;
+    map.place(new Tile(0, 1), 1, 1);
+
+    while(!stack.empty())
+    {
+        sf::Vector2i cell = stack.back();
+        std::vector<sf::Vector2i> choices;
+
+        for(const sf::Vector2i& offset : offsets)
+        {
+            sf::Vector2i next = cell + offset;
+
+            if(next.x > 0 && next.y > 0 && next.x < map.width() - 1 && next.y < map.length() - 1 && !open[next.x + next.y * map.width()])
+            {
+                choices.push_back(next);
+            }
+        }
+
+        if(choices.empty())
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        sf::Vector2i next = choices[rand() % choices.size()];
+        sf::Vector2i wall((cell.x + next.x) / 2, (cell.y + next.y) / 2);
+
+        open[next.x + next.y * map.width()] = true;
+        map.place(new Tile(0, 1), wall.x, wall.y);
+        map.place(new Tile(0, 1), next.x, next.y);
+        stack.push_back(next);
+    }
+
+    // A few extra openings to create loops
+    for(int i = 0; i < map.width() * map.length() / 20; i++)
+    {
+        int x = 1 + rand() % (map.width() - 2);
+        int y = 1 + rand() % (map.length() - 2);
+
+        if(!map.valid(x, y))
+        {
+            map.place(new Tile(0, 1), x, y);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// - Reference Solver
+//----------------------------------------------------------------------------
+// Plain breadth-first search over the movement rules evaluated from scratch:
+// the target must hold a tile and, for a limited jump, both ends must lie
+// within it. Returns step distances from the source, -1 if unreachable
+//----------------------------------------------------------------------------
+static bool referenceStep(const Map& map, int x, int y, int tx, int ty, float jump)
+{
+    if(!map.valid(tx, ty))
+    {
+        return false;
+    }
+    else if(jump == FLT_MAX)
+    {
+        return true;
+    }
+
+    return map.valid(x, y) && fabs(map.height(tx, ty) - map.height(x, y)) <= jump;
+}
+
+static std::vector<int> referenceDistances(const Map& map, const sf::Vector2i& source, float jump, int limit)
+{
+    const sf::Vector2i offsets[4] = {sf::Vector2i(1, 0), sf::Vector2i(0, 1), sf::Vector2i(-1, 0), sf::Vector2i(0, -1)};
+    std::vector<int> distance(map.width() * map.length(), -1);
+    std::queue<sf::Vector2i> queue;
+
+    distance[source.x + source.y * map.width()] = 0;
+    queue.push(source);
+
+    while(!queue.empty())
+    {
+        sf::Vector2i cell = queue.front();
+        queue.pop();
+
+        int d = distance[cell.x + cell.y * map.width()];
+        if(d == limit)
+        {
+            continue;
+        }
+
+        for(const sf::Vector2i& offset : offsets)
+        {
+            sf::Vector2i next = cell + offset;
+
+            if(next.x < 0 || next.y < 0 || next.x >= map.width() || next.y >= map.length())
+            {
+                continue;
+            }
+            else if(distance[next.x + next.y * map.width()] < 0 && referenceStep(map, cell.x, cell.y, next.x, next.y, jump))
+            {
+                distance[next.x + next.y * map.width()] = d + 1;
+                queue.push(next);
+            }
+        }
+    }
+
+    return distance;
+}
+
+//----------------------------------------------------------------------------
+// - Path Validity
+//----------------------------------------------------------------------------
+// Returns whether the path starts at the source, ends at the destination and
+// only takes allowed single steps
+//----------------------------------------------------------------------------
+static bool validPath(const Map& map, const std::deque<sf::Vector2f>& path, const sf::Vector2i& source, const sf::Vector2i& destination, float jump)
+{
+    if(path.empty() || path.front() != sf::Vector2f(source.x, source.y) || path.back() != sf::Vector2f(destination.x, destination.y))
+    {
+        return false;
+    }
+
+    for(int i = 1; i < path.size(); i++)
+    {
+        int x = path[i - 1].x, y = path[i - 1].y;
+        int tx = path[i].x, ty = path[i].y;
+
+        if(abs(tx - x) + abs(ty - y) != 1 || !referenceStep(map, x, y, tx, ty, jump))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// - Custom Rules Actor
+//----------------------------------------------------------------------------
+// Keeps the standard laws but claims otherwise, so that reach() takes the
+// breadth-first search instead of the packed flood fill
+//----------------------------------------------------------------------------
+class CustomActor : public Actor
+{
+public:
+    CustomActor(const TextureRegion& texture, const Map* ground) : Actor(texture, ground) {}
+    virtual bool standardRules() const {return false;}
+};
+
+//----------------------------------------------------------------------------
+// - Check Reach
+//----------------------------------------------------------------------------
+// * actor : actor using the standard rules, placed at the source
+// * custom : actor using the breadth-first search, placed at the source
+// Compares both reach sets against the reference solver. Returns the number
+// of mismatches
+//----------------------------------------------------------------------------
+static int checkReach(const Map& map, const Actor& actor, const CustomActor& custom, const sf::Vector2i& source, float jump)
+{
+    std::vector<int> bounded = referenceDistances(map, source, jump, actor.getMove());
+    std::set<std::pair<int, int>> expected, flooded, searched;
+    int mismatches = 0;
+
+    // Reachable within move, and unoccupied
+    for(int i = 0; i < bounded.size(); i++)
+    {
+        if(bounded[i] >= 0 && !map.playerAt(i % map.width(), i / map.width()))
+        {
+            expected.insert(std::make_pair(i % map.width(), i / map.width()));
+        }
+    }
+    for(const sf::Vector2f& position : actor.reach())
+    {
+        flooded.insert(std::make_pair(int(position.x), int(position.y)));
+    }
+    for(const sf::Vector2f& position : custom.reach())
+    {
+        searched.insert(std::make_pair(int(position.x), int(position.y)));
+    }
+
+    if(expected != flooded)
+    {
+        std::cout << "  reach mismatch at (" << source.x << ", " << source.y << ")" << std::endl;
+        mismatches++;
+    }
+    if(expected != searched)
+    {
+        std::cout << "  custom rules reach mismatch at (" << source.x << ", " << source.y << ")" << std::endl;
+        mismatches++;
+    }
+
+    return mismatches;
+}
+
+//----------------------------------------------------------------------------
+// - Scenario
+//----------------------------------------------------------------------------
+struct Scenario
+{
+    const char* name;
+    void (*generate)(Map&);
+    float jump;
+    int occupancy;
+};
+
+//----------------------------------------------------------------------------
+// - Run Scenario
+//----------------------------------------------------------------------------
+// Returns the number of mismatches against the reference solver
+//----------------------------------------------------------------------------
+static int run(const Scenario& scenario, const sf::Texture& texture, int size, int queries)
+{
+    Map map(size, size);
+    scenario.generate(map);
+
+    int movementClass = scenario.jump == FLT_MAX ? 0 : map.addMovementClass(scenario.jump);
+
+    // Bystanders occupying a share of the open cells
+    std::vector<Actor*> bystanders;
+    for(int x = 0; x < size; x++)
+    {
+        for(int y = 0; y < size; y++)
+        {
+            if(map.valid(x, y) && rand() % 100 < scenario.occupancy)
+            {
+                Actor* bystander = new Actor(texture, &map);
+                bystander->setPosition(sf::Vector3f(x, y, map.height(x, y)));
+                map.enter(bystander, x, y);
+                bystanders.push_back(bystander);
+            }
+        }
+    }
+
+    // Query sources and destinations on open, unoccupied cells
+    std::vector<sf::Vector2i> sources, destinations;
+    while(sources.size() < queries)
+    {
+        sf::Vector2i source(rand() % size, rand() % size), destination(rand() % size, rand() % size);
+
+        if(map.valid(source.x, source.y) && !map.playerAt(source.x, source.y) && map.valid(destination.x, destination.y) && source != destination)
+        {
+            sources.push_back(source);
+            destinations.push_back(destination);
+        }
+    }
+
+    Actor actor(texture, &map);
+    actor.setMovementClass(movementClass);
+
+    CustomActor custom(texture, &map);
+    custom.setMovementClass(movementClass);
+
+    int mismatches = 0;
+    double excess = 0;
+    int planned = 0;
+
+    // Reach from the corners and edge midpoints, where the search window
+    // overhangs the map
+    const sf::Vector2i edges[8] = {
+        sf::Vector2i(0, 0), sf::Vector2i(size - 1, 0), sf::Vector2i(0, size - 1), sf::Vector2i(size - 1, size - 1),
+        sf::Vector2i(size / 2, 0), sf::Vector2i(0, size / 2), sf::Vector2i(size - 1, size / 2), sf::Vector2i(size / 2, size - 1)
+    };
+
+    for(const sf::Vector2i& source : edges)
+    {
+        if(!map.valid(source.x, source.y) || map.playerAt(source.x, source.y))
+        {
+            continue;
+        }
+
+        for(int move = 0; move <= 10; move++)
+        {
+            actor.setMove(move);
+            custom.setMove(move);
+            actor.setPosition(sf::Vector3f(source.x, source.y, map.height(source.x, source.y)));
+            custom.setPosition(sf::Vector3f(source.x, source.y, map.height(source.x, source.y)));
+            map.enter(&actor, source.x, source.y);
+
+            mismatches += checkReach(map, actor, custom, source, scenario.jump);
+
+            map.exit(source.x, source.y);
+        }
+    }
+
+    // Validation pass
+    for(int q = 0; q < queries; q++)
+    {
+        const sf::Vector2i& source = sources[q];
+        const sf::Vector2i& destination = destinations[q];
+        int move = 3 + q % 8;
+
+        actor.setMove(move);
+        custom.setMove(move);
+        actor.setPosition(sf::Vector3f(source.x, source.y, map.height(source.x, source.y)));
+        custom.setPosition(sf::Vector3f(source.x, source.y, map.height(source.x, source.y)));
+        map.enter(&actor, source.x, source.y);
+
+        std::vector<int> bounded = referenceDistances(map, source, scenario.jump, move);
+        std::vector<int> unbounded = referenceDistances(map, source, scenario.jump, -1);
+
+        // Reach, by flood fill and by breadth-first search
+        mismatches += checkReach(map, actor, custom, source, scenario.jump);
+
+        // Shortest path: exact length within move range, empty otherwise
+        int distance = bounded[destination.x + destination.y * size];
+        std::deque<sf::Vector2f> path = actor.shortestPath(sf::Vector2f(destination.x, destination.y));
+
+        if(distance >= 0)
+        {
+            if(!validPath(map, path, source, destination, scenario.jump) || path.size() - 1 != distance)
+            {
+                std::cout << "  shortestPath mismatch to (" << destination.x << ", " << destination.y << ")" << std::endl;
+                mismatches++;
+            }
+        }
+        else if(!path.empty())
+        {
+            std::cout << "  shortestPath found an impossible path" << std::endl;
+            mismatches++;
+        }
+
+        // Planned path: valid whenever reachable at all, near-optimal length
+        distance = unbounded[destination.x + destination.y * size];
+        path = actor.plan(sf::Vector2f(destination.x, destination.y));
+
+        if(distance >= 0)
+        {
+            if(!validPath(map, path, source, destination, scenario.jump))
+            {
+                std::cout << "  plan mismatch to (" << destination.x << ", " << destination.y << ")" << std::endl;
+                mismatches++;
+            }
+            else
+            {
+                excess += double(path.size() - 1) / distance;
+                planned++;
+            }
+        }
+        else if(!path.empty())
+        {
+            std::cout << "  plan found an impossible path" << std::endl;
+            mismatches++;
+        }
+
+        map.exit(source.x, source.y);
+    }
+
+    // Timing passes
+    sf::Clock timer;
+    unsigned long allocated;
+    float seconds[3];
+    unsigned long counts[3];
+
+    for(int pass = 0; pass < 3; pass++)
+    {
+        allocated = allocations;
+        timer.restart();
+
+        for(int q = 0; q < queries; q++)
+        {
+            const sf::Vector2i& source = sources[q];
+            sf::Vector2f destination(destinations[q].x, destinations[q].y);
+
+            actor.setMove(3 + q % 8);
+            actor.setPosition(sf::Vector3f(source.x, source.y, 0));
+
+            if(pass == 0)       actor.reach();
+            else if(pass == 1)  actor.shortestPath(destination);
+            else                actor.plan(destination);
+        }
+
+        seconds[pass] = timer.restart().asSeconds();
+        counts[pass] = allocations - allocated;
+    }
+
+    const char* names[3] = {"reach", "shortestPath", "plan"};
+
+    std::cout << scenario.name << " (" << size << "x" << size << ", " << bystanders.size() << " bystanders): "
+        << mismatches << " mismatches, plan length ratio " << std::setprecision(3) << (planned ? excess / planned : 1) << std::endl;
+
+    for(int pass = 0; pass < 3; pass++)
+    {
+        std::cout << "  " << std::setw(14) << names[pass]
+            << std::setw(12) << std::setprecision(6) << queries / std::max(seconds[pass], 1e-6f) << " q/s"
+            << std::setw(10) << std::setprecision(4) << double(counts[pass]) / queries << " allocs/q" << std::endl;
+    }
+
+    for(Actor* bystander : bystanders)
+    {
+        delete bystander;
+    }
+
+    return mismatches;
+}
+
+//----------------------------------------------------------------------------
+// - Run Large Map
+//----------------------------------------------------------------------------
+// Times plan() alone on a large height-varied map, where the bounded searches
+// do not apply, then the repair of the abstract graph after single terrain
+// edits. Every path is still checked against the reference solver, outside
+// the timed sections. Returns the number of mismatches
+//----------------------------------------------------------------------------
+static int runLarge(const sf::Texture& texture, int size, int queries)
+{
+    // Left to the process exit: the depth buffer unlinks each tile on its own,
+    // which would dwarf the run on a map this large
+    Map& map = *new Map(size, size);
+    generateHeights(map);
+
+    int movementClass = map.addMovementClass(1);
+
+    Actor actor(texture, &map);
+    actor.setMovementClass(movementClass);
+
+    // The first query pays for the whole abstract graph; time it separately
+    sf::Clock timer;
+    map.getPathHierarchy(movementClass).refresh();
+    float build = timer.restart().asSeconds();
+
+    int mismatches = 0;
+    float total = 0, worst = 0;
+    double excess = 0;
+    int planned = 0;
+
+    for(int q = 0; q < queries; q++)
+    {
+        sf::Vector2i source(rand() % size, rand() % size), destination(rand() % size, rand() % size);
+
+        actor.setPosition(sf::Vector3f(source.x, source.y, map.height(source.x, source.y)));
+
+        timer.restart();
+        std::deque<sf::Vector2f> path = actor.plan(sf::Vector2f(destination.x, destination.y));
+        float seconds = timer.restart().asSeconds();
+
+        total += seconds;
+        worst = std::max(worst, seconds);
+
+        int distance = referenceDistances(map, source, 1, -1)[destination.x + destination.y * size];
+
+        if(distance >= 0 ? !validPath(map, path, source, destination, 1) : !path.empty())
+        {
+            std::cout << "  plan mismatch from (" << source.x << ", " << source.y << ") to (" << destination.x << ", " << destination.y << ")" << std::endl;
+            mismatches++;
+        }
+        else if(distance > 0)
+        {
+            excess += double(path.size() - 1) / distance;
+            planned++;
+        }
+    }
+
+    // Terrain edits: each raises or digs out one position, then the graph is
+    // repaired around it and a path to the edit is checked
+    float repair = 0, worstRepair = 0;
+
+    for(int e = 0; e < queries; e++)
+    {
+        sf::Vector2i source(rand() % size, rand() % size), edit(rand() % size, rand() % size);
+
+        if(edit == source)
+        {
+            continue;
+        }
+
+        if(rand() % 2)
+        {
+            map.place(new Tile(0, 1), edit.x, edit.y);
+        }
+        else
+        {
+            map.remove(edit.x, edit.y, (int)map.height(edit.x, edit.y) - 1);
+        }
+
+        timer.restart();
+        map.getPathHierarchy(movementClass).refresh();
+        float seconds = timer.restart().asSeconds();
+
+        repair += seconds;
+        worstRepair = std::max(worstRepair, seconds);
+
+        if(map.height(source.x, source.y) < 0)
+        {
+            continue;
+        }
+
+        actor.setPosition(sf::Vector3f(source.x, source.y, map.height(source.x, source.y)));
+
+        std::deque<sf::Vector2f> path = actor.plan(sf::Vector2f(edit.x, edit.y));
+        int distance = referenceDistances(map, source, 1, -1)[edit.x + edit.y * size];
+
+        if(distance >= 0 ? !validPath(map, path, source, edit, 1) : !path.empty())
+        {
+            std::cout << "  plan mismatch after editing (" << edit.x << ", " << edit.y << ")" << std::endl;
+            mismatches++;
+        }
+    }
+
+    std::cout << "large heights (" << size << "x" << size << "): " << mismatches << " mismatches, plan length ratio "
+        << std::setprecision(3) << (planned ? excess / planned : 1) << std::endl
+        << "  " << std::setw(14) << "graph build" << std::setw(12) << std::setprecision(4) << build * 1000 << " ms" << std::endl
+        << "  " << std::setw(14) << "plan" << std::setw(12) << std::setprecision(4) << total * 1000 / queries << " ms/q"
+        << std::setw(10) << std::setprecision(4) << worst * 1000 << " ms worst" << std::endl
+        << "  " << std::setw(14) << "edit repair" << std::setw(12) << std::setprecision(4) << repair * 1000 / queries << " ms/q"
+        << std::setw(10) << std::setprecision(4) << worstRepair * 1000 << " ms worst" << std::endl;
+
+    return mismatches;
+}
+
+int main()
+{
+    const int size = 64;
+    const int queries = 2000;
+    const Scenario scenarios[] = {
+        {"flat", generateFlat, FLT_MAX, 0},
+        {"heights", generateHeights, 1, 0},
+        {"maze", generateMaze, FLT_MAX, 0},
+        {"dense occupancy", generateFlat, FLT_MAX, 40}
+    };
+
+    srand(1);
+
+    sf::Texture texture;
+    texture.create(48, 48);
+
+    int mismatches = 0;
+
+    for(const Scenario& scenario : scenarios)
+    {
+        mismatches += run(scenario, texture, size, queries);
+    }
+
+    mismatches += runLarge(texture, 1024, 50);
+
+    std::cout << (mismatches ? "FAILED" : "OK") << std::endl;
+
+    return mismatches ? 1 : 0;
+}
\ No newline at end of file
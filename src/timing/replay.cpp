@@ -0,0 +1,307 @@
+// Input replay benchmark: records one full headless turn (move next to the
+// enemy, attack it, wait) played by a scripted player, paced by jittery
+// wall-clock frame times as in the windowed game, and saves it to turn.rec.
+// Alternatively, loads a recording saved by the game's --record option. The
+// recording is then replayed from its file repeatedly, one fixed frame per
+// step. Reports game frames and processing time spent in each phase of the
+// turn, the latency from each key press to the next poll, and frame time
+// percentiles. Every replay must poll on its recorded frames and end in the
+// recorded state. Build alongside the map, object, sprite, screen, control,
+// skill and game sources (excluding the mains) with -pthread, -std=c++20 and
+// the sfml libs. Usage: replay [seed] [replays] [recording], where a loaded
+// recording's own seed replaces the first argument
+#include "../game/Scene.h"
+#include "../game/Simulation.h"
+#include "../game/InputManager.h"
+#include "../game/ActionScheduler.h"
+#include "../control/ScriptedInput.h"
+#include "../control/InputRecorder.h"
+#include "../control/InputPlayer.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdlib.h>
+
+static const int PHASES = Phase::MainMenu + 1;
+static const char* PHASE_NAMES[PHASES] = {"idle", "browsing", "battle menu", "action menu", "destination", "moving", "target", "confirming", "casting", "main menu"};
+
+//================================================================================
+// ** TurnScene
+//================================================================================
+// Scene exposing what the scripted player needs to see to play a turn
+//================================================================================
+class TurnScene : public Scene
+{
+public:
+    Actor* actor() const {return actors_[acting_];}
+    Actor* enemy() const {return actors_[(acting_ + 1) % actors_.size()];}
+    const Cursor* moveSelector() const {return moveSelector_;}
+    const Cursor* targetSelector() const {return targetSelector_;}
+};
+
+//----------------------------------------------------------------------------
+// - Steer Cursor
+//----------------------------------------------------------------------------
+// Returns the arrow moving a cursor one tile closer to a target, or Return
+// once it is there
+//----------------------------------------------------------------------------
+sf::Keyboard::Key steer(const Cursor* cursor, const sf::Vector2i& target)
+{
+    sf::Vector2i at(round(cursor->position().x), round(cursor->position().y));
+
+    if(at.x < target.x) return sf::Keyboard::Right;
+    if(at.x > target.x) return sf::Keyboard::Left;
+    if(at.y < target.y) return sf::Keyboard::Down;
+    if(at.y > target.y) return sf::Keyboard::Up;
+
+    return sf::Keyboard::Return;
+}
+
+//----------------------------------------------------------------------------
+// - Turn Finished?
+//----------------------------------------------------------------------------
+// A turn ends once the next actor's battle menu is up
+//----------------------------------------------------------------------------
+bool finished(const Scene& scene)
+{
+    return scene.turn() > 1 && scene.phase() == Phase::BattleMenu;
+}
+
+//----------------------------------------------------------------------------
+// - Clean Up
+//----------------------------------------------------------------------------
+// Drops the scene's pending actions and controls so the next can start afresh
+//----------------------------------------------------------------------------
+void cleanUp()
+{
+    InputManager::instance().setSource(0);
+    InputManager::instance().clear();
+    ActionScheduler::instance().clear();
+}
+
+int main(int argc, char** argv)
+{
+    unsigned seed = argc > 1 ? strtoul(argv[1], 0, 10) : 1;
+    int replays = argc > 2 ? atoi(argv[2]) : 20;
+    const unsigned long limit = 100000;
+
+    std::string recording = argc > 3 ? argv[3] : "turn.rec";
+    uint64_t expected = 0;
+
+    // Recording: a scripted player steering by the scene's phase
+    if(argc <= 3)
+    {
+        Simulation simulation(seed);
+        ScriptedInput script;
+        InputRecorder recorder(script);
+        InputManager::instance().setSource(&recorder);
+
+        TurnScene* scene = new TurnScene;
+        sf::Vector2i destination(-1, -1), target(-1, -1);
+        bool planned = false;
+
+        script.setGenerator([scene, &destination, &target, &planned](){
+            // Plan the closest reachable position next to the enemy, once the
+            // turn is under way
+            if(!planned && scene->turn() > 0)
+            {
+                Actor* actor = scene->actor();
+                target = sf::Vector2i(round(scene->enemy()->position().x), round(scene->enemy()->position().y));
+                int best = 1 << 30;
+
+                for(const sf::Vector2f& position : actor->reach())
+                {
+                    int x = round(position.x), y = round(position.y);
+                    int distance = abs(x - actor->position().x) + abs(y - actor->position().y);
+
+                    if(abs(x - target.x) + abs(y - target.y) == 1 && distance < best)
+                    {
+                        destination = sf::Vector2i(x, y);
+                        best = distance;
+                    }
+                }
+
+                planned = true;
+            }
+
+            if(destination.x < 0)
+            {
+                return sf::Keyboard::Unknown;
+            }
+
+            switch(scene->phase())
+            {
+                case Phase::BattleMenu:
+                case Phase::ActionMenu:
+                case Phase::ConfirmingTargets:
+                    return sf::Keyboard::Return;
+                case Phase::SelectingDestination:
+                    return steer(scene->moveSelector(), destination);
+                case Phase::SelectingTarget:
+                    return steer(scene->targetSelector(), target);
+                default:
+                    return sf::Keyboard::Unknown;
+            }
+        });
+
+        // Frame times of a windowed game drawing at uneven rates, from a
+        // quarter of a frame up to a few frames, stepped off in whole frames
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> frameTime(0.25 / FPS, 3 / FPS);
+
+        scene->start();
+        while(!finished(*scene) && simulation.frames() < limit)
+        {
+            simulation.advance(frameTime(random));
+        }
+
+        if(!finished(*scene))
+        {
+            if(destination.x < 0)
+            {
+                std::cout << "Seed " << seed << " leaves the enemy out of reach, try another" << std::endl;
+            }
+            else
+            {
+                std::cout << "Scripted turn did not finish within " << limit << " frames" << std::endl;
+            }
+            return 1;
+        }
+
+        if(!recorder.save(recording, seed, simulation.frames(), scene->hash()))
+        {
+            std::cout << "Could not save " << recording << std::endl;
+            return 1;
+        }
+
+        cleanUp();
+        delete scene;
+    }
+
+    InputPlayer loader;
+    if(!loader.load(recording))
+    {
+        std::cout << "Could not load " << recording << std::endl;
+        return 1;
+    }
+
+    seed = loader.seed();
+    expected = loader.hash();
+
+    // Replays
+    std::vector<double> frameTimes;
+    double phaseTimes[PHASES] = {0};
+    long phaseFrames[PHASES] = {0};
+    std::vector<long> pressLatencies[PHASES];
+    int divergences = 0, mismatches = 0, polled = 0;
+    long turnFrames = 0;
+    double turnTime = 0;
+
+    for(int r = 0; r < replays; r++)
+    {
+        Simulation simulation(seed);
+        InputPlayer player;
+        player.load(recording);
+
+        // Replayed keys are echoed into a recorder to spot the presses
+        InputRecorder echo(player);
+        InputManager::instance().setSource(&echo);
+
+        Scene* scene = new Scene;
+        scene->start();
+
+        int polls = 0;
+        long pressFrame = -1;
+        Phase::Stage pressPhase = Phase::Idle;
+
+        // Replays run for as many frames as the recorded game did
+        while(simulation.frames() < player.frames() && simulation.frames() < limit)
+        {
+            Phase::Stage phase = scene->phase();
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            simulation.step();
+            double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            frameTimes.push_back(elapsed);
+            phaseTimes[phase] += elapsed;
+            phaseFrames[phase]++;
+            turnTime += elapsed;
+
+            // A poll happened: close the latency of the last key press, and
+            // open one if this poll pressed a key
+            if(echo.polls().size() > polls)
+            {
+                if(pressFrame >= 0)
+                {
+                    pressLatencies[pressPhase].push_back(simulation.frames() - pressFrame);
+                    pressFrame = -1;
+                }
+
+                if(echo.polls().back().keys.any())
+                {
+                    pressFrame = simulation.frames();
+                    pressPhase = phase;
+                }
+
+                polls = echo.polls().size();
+            }
+        }
+
+        turnFrames += simulation.frames();
+        divergences += player.diverged() || !player.finished() || simulation.frames() < player.frames();
+        polled = polls;
+
+        if(scene->hash() != expected)
+        {
+            mismatches++;
+        }
+
+        cleanUp();
+        delete scene;
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    int n = frameTimes.size();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << replays << " replays of " << polled << " polls, " << turnFrames / std::max(replays, 1) << " frames per turn" << std::endl;
+    std::cout << "  turn:   " << turnTime / std::max(replays, 1) << " us total, " << turnTime / std::max(n, 1) << " us/frame" << std::endl;
+
+    for(int p = 0; p < PHASES; p++)
+    {
+        if(phaseFrames[p] == 0)
+        {
+            continue;
+        }
+
+        std::cout << "  " << std::left << std::setw(12) << PHASE_NAMES[p] << std::right
+            << std::setw(8) << double(phaseFrames[p]) / replays << " frames "
+            << std::setw(10) << phaseTimes[p] / replays << " us";
+
+        if(!pressLatencies[p].empty())
+        {
+            std::vector<long>& latencies = pressLatencies[p];
+            std::sort(latencies.begin(), latencies.end());
+
+            long total = 0;
+            for(long latency : latencies) total += latency;
+
+            std::cout << "   press to poll: " << double(total) / latencies.size() << " frames mean, " << latencies.back() << " max";
+        }
+
+        std::cout << std::endl;
+    }
+
+    if(n > 0)
+    {
+        std::cout << "  frame time: p50 " << frameTimes[n / 2] << " us, p90 " << frameTimes[n * 9 / 10]
+            << " us, p99 " << frameTimes[n * 99 / 100] << " us, max " << frameTimes[n - 1] << " us" << std::endl;
+    }
+
+    std::cout << "  " << divergences << " diverged replays, " << mismatches << " state mismatches" << std::endl;
+
+    return divergences > 0 || mismatches > 0;
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+// Action scheduler benchmark: scheduling, per-frame stepping and cancellation
+// costs with 50k pending timed actions, a few beyond the timer wheel's span,
+// and triggered actions polled each frame. Every action's firing frame is
+// checked against its delay. Heap allocations are then counted during a
+// steady stream of timed and signaled actions, and must be zero. Finally, a
+// triggered action waiting on a signal must not fire before it is emitted,
+// and clearing the schedule must destroy suspended scripts. Build with
+// ../game/ActionScheduler.cpp, ../game/Action.cpp, ../game/Animations.cpp,
+// ../game/ThreadPool.cpp, ../game/Signal.cpp, ../game/Script.cpp,
+// ../objects/AnimatedObject.cpp, -pthread, -std=c++20 and the sfml libs
+#include "../game/ActionScheduler.h"
+#include "../game/Animations.h"
+#include "../game/Script.h"
+#include <SFML/System.hpp>
+#include <iostream>
+#include <new>
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------
+// - Allocation Counting
+//----------------------------------------------------------------------------
+static unsigned long allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    allocations++;
+
+    void* memory = malloc(size ? size : 1);
+    if(!memory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    free(memory);
+}
+
+//----------------------------------------------------------------------------
+// - Dropped Scripts
+//----------------------------------------------------------------------------
+// Scripts holding a local that counts its destruction, waiting on frames or a
+// signal they are never resumed from
+//----------------------------------------------------------------------------
+struct Sentinel
+{
+    int*    destroyed;
+    ~Sentinel() {(*destroyed)++;}
+};
+
+static Script waitFrames(int* destroyed)
+{
+    Sentinel sentinel{destroyed};
+    co_await frames(1000);
+}
+
+static Script waitSignal(Signal& signal, int* destroyed)
+{
+    Sentinel sentinel{destroyed};
+    co_await signal;
+}
+
+int main()
+{
+    const int timed = 50000;
+    const int triggered = 1000;
+    const int distant = 4;
+    const int horizon = 20000;
+    const unsigned long span = 1UL << 24;
+
+    ActionScheduler& scheduler = ActionScheduler::instance();
+    int count = timed + triggered + distant;
+    int senders[2];
+
+    std::vector<long> expected(count, -1);
+    std::vector<long> fired(count, -1);
+    sf::Clock timer;
+
+    srand(1);
+
+    // Scheduling
+    timer.restart();
+    for(int i = 0; i < timed; i++)
+    {
+        int delay = rand() % horizon;
+        scheduler.schedule(Action([i, &fired, &scheduler](){fired[i] = scheduler.frame();}, delay, &senders[i % 10 == 0]));
+        expected[i] = i % 10 == 0 ? -1 : delay + 1;
+    }
+    float scheduling = timer.restart().asMicroseconds();
+
+    for(int i = timed; i < timed + triggered; i++)
+    {
+        unsigned long at = rand() % horizon + 1;
+        Action action([i, &fired, &scheduler](){fired[i] = scheduler.frame();}, -1);
+        action.setTrigger([at, &scheduler](){return scheduler.frame() >= at;});
+        scheduler.schedule(std::move(action));
+        expected[i] = at;
+    }
+
+    for(int i = timed + triggered; i < count; i++)
+    {
+        unsigned long delay = span + i;
+        scheduler.schedule(Action([i, &fired, &scheduler](){fired[i] = scheduler.frame();}, delay));
+        expected[i] = delay + 1;
+    }
+
+    // Cancellation of every tenth timed action
+    timer.restart();
+    scheduler.cancel(&senders[1]);
+    float cancelling = timer.restart().asMicroseconds();
+
+    // Stepping through the busy horizon, then the long quiet run to the last
+    // distant actions
+    unsigned long busy = 0;
+    float stepping = 0;
+
+    while(!scheduler.empty())
+    {
+        if(scheduler.frame() == horizon)
+        {
+            stepping = timer.restart().asMicroseconds();
+            busy = scheduler.frame();
+        }
+
+        Animations::instance().update(1 / FPS);
+    }
+    float quiet = timer.restart().asMicroseconds();
+
+    // Steady stream: every frame schedules the same spread of timed actions,
+    // and actions waiting on a signal emitted each frame. Allocations are only
+    // counted once every wheel slot has seen its largest load
+    const int stream = 64;
+    const int warmup = 3 << 12;
+    const int measured = 1 << 12;
+
+    Signal tick;
+    long streamed = 0;
+    unsigned long allocated = 0;
+    unsigned long start = scheduler.frame();
+
+    for(int f = 0; f < warmup + measured; f++)
+    {
+        if(f == warmup)
+        {
+            allocated = allocations;
+            timer.restart();
+        }
+
+        for(int j = 0; j < stream; j++)
+        {
+            scheduler.schedule(Action([&streamed](){streamed++;}, j * 37 % 200));
+        }
+
+        for(int j = 0; j < stream / 8; j++)
+        {
+            scheduler.schedule(Action([&streamed](){streamed++;}, j), tick);
+        }
+
+        tick.emit();
+        Animations::instance().update(1 / FPS);
+    }
+    float streaming = timer.restart().asMicroseconds();
+    unsigned long steady = allocations - allocated;
+
+    // A triggered action waiting on a signal must not be polled before it,
+    // even though its trigger already holds
+    Signal go;
+    long signaled = -1;
+    Action waiting([&signaled, &scheduler](){signaled = scheduler.frame();}, 100);
+    waiting.setTrigger([](){return true;});
+    scheduler.schedule(std::move(waiting), go);
+
+    for(int f = 0; f < 10; f++)
+    {
+        Animations::instance().update(1 / FPS);
+    }
+
+    bool early = signaled >= 0;
+    unsigned long emitted = scheduler.frame();
+    go.emit();
+    Animations::instance().update(1 / FPS);
+    bool late = signaled != emitted + 1;
+
+    // Clearing the schedule destroys suspended scripts, including one whose
+    // signal no longer exists
+    int destroyed = 0;
+    waitFrames(&destroyed);
+    {
+        Signal never;
+        waitSignal(never, &destroyed);
+    }
+    scheduler.clear();
+    bool leaked = destroyed != 2 || Script::suspended() != 0;
+
+    int mismatches = 0;
+    for(int i = 0; i < count; i++)
+    {
+        if(fired[i] != expected[i])
+        {
+            if(mismatches++ < 10)
+            {
+                std::cout << "MISMATCH: action " << i << " fired at " << fired[i] << ", expected " << expected[i] << std::endl;
+            }
+        }
+    }
+
+    std::cout << count << " actions, " << scheduler.frame() << " frames" << std::endl;
+    std::cout << "  schedule: " << scheduling * 1000 / timed << " ns/action" << std::endl;
+    std::cout << "  cancel:   " << cancelling << " us for " << timed / 10 << " actions" << std::endl;
+    std::cout << "  busy:     " << stepping * 1000 / busy << " ns/frame over " << busy << " frames" << std::endl;
+    std::cout << "  quiet:    " << quiet * 1000 / (scheduler.frame() - busy) << " ns/frame over " << scheduler.frame() - busy << " frames" << std::endl;
+    std::cout << "  stream:   " << streaming * 1000 / (measured * (stream + stream / 8)) << " ns/action over " << scheduler.frame() - start << " frames, " << streamed << " executed" << std::endl;
+    std::cout << "  " << steady << " steady-state allocations" << std::endl;
+    std::cout << "  " << mismatches << " mismatches" << std::endl;
+    std::cout << "  signaled trigger " << (early ? "fired before its signal" : late ? "did not fire after its signal" : "waited for its signal") << std::endl;
+    std::cout << "  " << 2 - destroyed << " suspended scripts leaked by clearing" << std::endl;
+
+    return mismatches > 0 || steady > 0 || early || late || leaked;
+}
\ No newline at end of file